@@ -32,6 +32,8 @@
 #include "apl/audio/audioplayerfactory.h"
 #include "apl/audio/speechmark.h"
 #include "apl/component/component.h"
+#include "apl/component/dirtypropertydecoder.h"
+#include "apl/component/dirtypropertyencoder.h"
 #include "apl/component/textmeasurement.h"
 #include "apl/content/configurationchange.h"
 #include "apl/content/content.h"
@@ -53,6 +55,7 @@
 #include "apl/graphic/graphic.h"
 #include "apl/graphic/graphicfilter.h"
 #include "apl/graphic/graphicpattern.h"
+#include "apl/livedata/columnarbatch.h"
 #include "apl/livedata/livearray.h"
 #include "apl/livedata/livemap.h"
 #include "apl/media/mediamanager.h"
@@ -88,6 +91,7 @@
 #include "apl/scenegraph/path.h"
 #include "apl/scenegraph/pathop.h"
 #include "apl/scenegraph/scenegraph.h"
+#include "apl/scenegraph/tessellation.h"
 #include "apl/scenegraph/edittextbox.h"
 #include "apl/scenegraph/textchunk.h"
 #include "apl/scenegraph/textlayout.h"
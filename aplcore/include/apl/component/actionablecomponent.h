@@ -68,6 +68,14 @@ public:
     CoreComponentPtr takeFocusFromChild(FocusDirection direction, const Rect& origin) override { return nullptr; }
     CoreComponentPtr getUserSpecifiedNextFocus(FocusDirection direction) override;
 
+    /**
+     * Record a pointer move that was coalesced into a later move.  The gestures of this component add
+     * it to their movement history, but no event handlers run.
+     * @param event The coalesced move.
+     * @param timestamp The time of the move.
+     */
+    void processPointerHistory(const PointerEvent& event, apl_time_t timestamp);
+
 protected:
     bool isFocusable() const override { return true; }
     void executeOnBlur() override;
@@ -0,0 +1,72 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_CHILD_HIT_INDEX_H
+#define _APL_CHILD_HIT_INDEX_H
+
+#include <vector>
+
+#include "apl/common.h"
+#include "apl/primitives/point.h"
+
+namespace apl {
+
+/**
+ * Spatial index over the children of a single component, used when hit-testing.
+ *
+ * Each child is stored with the axis-aligned bounding box it covers in the coordinate space of
+ * its parent's content (the parent's local space offset by the scroll position), including the
+ * child transform.  The boxes are sorted by their leading edge along one axis together with the
+ * furthest trailing edge seen so far, so the children that may contain a point are found with two
+ * binary searches.  The axis is the one along which the children are spread the most, which puts
+ * the items of a long Sequence or a wide row on the fast path.
+ *
+ * The index only holds geometry.  The owning component rebuilds it when a child is added, removed,
+ * moved, resized or transformed.
+ */
+class ChildHitIndex {
+public:
+    /**
+     * Rebuild the index.
+     * @param children The children of the component.
+     */
+    void build(const std::vector<CoreComponentPtr>& children);
+
+    /**
+     * Find the children whose bounding box contains a point.  A child whose bounding box does not
+     * contain the point cannot contain it.
+     * @param point The point in the content coordinates of the parent.
+     * @return Indices of the matching children, last child first.  The vector is reused by the next query.
+     */
+    const std::vector<size_t>& query(const Point& point) const;
+
+private:
+    struct Entry {
+        float low;      // Leading edge along the sort axis
+        float high;     // Trailing edge along the sort axis
+        float crossLow;
+        float crossHigh;
+        size_t index;
+    };
+
+    std::vector<Entry> mEntries;      // Sorted by leading edge
+    std::vector<float> mReach;        // Furthest trailing edge of mEntries[0..i]
+    bool mHorizontal = false;
+    mutable std::vector<size_t> mResult;
+};
+
+} // namespace apl
+
+#endif // _APL_CHILD_HIT_INDEX_H
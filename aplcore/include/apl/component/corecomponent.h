@@ -22,6 +22,7 @@
 
 #include "apl/apl_config.h"
 
+#include "apl/component/childhitindex.h"
 #include "apl/component/component.h"
 #include "apl/component/textmeasurement.h"
 #include "apl/engine/context.h"
@@ -34,6 +35,7 @@
 
 #ifdef SCENEGRAPH
 #include "apl/scenegraph/common.h"
+#include "apl/utils/jsonsink.h"
 #endif // SCENEGRAPH
 
 namespace apl {
@@ -43,6 +45,7 @@ class ComponentPropDefSet;
 class LayoutRebuilder;
 class Pointer;
 struct PointerEvent;
+class SearchVisitor;
 class StickyChildrenTree;
 
 using ConstComponentPropIterator = std::map<PropertyKey, ComponentPropDef>::const_iterator;
@@ -130,6 +133,14 @@ public:
      */
     virtual void raccept(Visitor<CoreComponent>& visitor) const;
 
+    /**
+     * Walk the component hierarchy in reverse order looking for the component under a point.  This
+     * follows the same order as raccept(), but skips the children that cannot contain the point.
+     * Overrides that restrict raccept() should restrict this the same way.
+     * @param visitor The search visitor
+     */
+    virtual void rsearch(SearchVisitor& visitor) const;
+
     /**
      * Find a component at or below this point in the hierarchy with the given id or uniqueId.
      * This variant of findComponentById must only be used by clients of Core, and not Core itself.
@@ -439,6 +450,20 @@ public:
      */
     rapidjson::Value serializeAll(rapidjson::Document::AllocatorType& allocator) const override;
 
+    /**
+     * Stream this component and its children into a JSON sink.  The output is identical to
+     * serialize(allocator), but only the properties of one component are held in memory at a time.
+     * @param sink The destination for the JSON output.
+     */
+    void serialize(JsonSink& sink) const;
+
+    /**
+     * Stream this component and all of its properties into a JSON sink.  The output is identical
+     * to serializeAll(allocator).
+     * @param sink The destination for the JSON output.
+     */
+    void serializeAll(JsonSink& sink) const;
+
     /**
      * Convert the dirty properties of this component into a JSON object.
      * @param allocator RapidJSON memory allocator
@@ -473,6 +498,12 @@ public:
      */
     virtual void serializeEvent(rapidjson::Value& out, rapidjson::Document::AllocatorType& allocator) const;
 
+    /**
+     * Serialize component-specific runtime state.  These members are appended after the
+     * children by serialize().
+     */
+    virtual void serializeExtra(rapidjson::Value& out, rapidjson::Document::AllocatorType& allocator) const {}
+
     /**
      * Set the height dimension for this component.
      */
@@ -1042,6 +1073,20 @@ protected:
      */
     virtual void ensureDisplayedChildren();
 
+    /**
+     * Search the children that may contain the point the visitor is looking for, last child first.
+     * Call this after the visitor has visited this component.
+     * @param visitor The search visitor
+     * @param filter Optional test on the index of a child.  Children that fail it are skipped.
+     */
+    void rsearchChildren(SearchVisitor& visitor, const std::function<bool(size_t)>& filter = nullptr) const;
+
+    /**
+     * Call this when a child is added or removed, or changes size, position or visibility.  This
+     * drops the spatial data kept for hit-testing and focus navigation.
+     */
+    void markChildLayoutStale();
+
     /**
      * @return True if layout change calculations should be propagated to component's children. Usually the case
      * when component itself is part of the layout tree.
@@ -1200,6 +1245,13 @@ private:
         rapidjson::Value& outArray, rapidjson::Document::AllocatorType& allocator, float realOpacity,
         float visibility, const Rect& visibleRect, int visualLayer);
 
+    void serializeMembers(rapidjson::Value& out, rapidjson::Document::AllocatorType& allocator, bool extended) const;
+    void serializeStream(JsonSink& sink, bool extended) const;
+
+    void buildVisualContextFragment(
+        rapidjson::Value& outArray, rapidjson::Document::AllocatorType& allocator, float realOpacity,
+        float visibility, const Rect& visibleRect, int visualLayer, rapidjson::Value& tags, bool actionable);
+
     void attachRebuilder(const std::shared_ptr<LayoutRebuilder>& rebuilder) { mRebuilder = rebuilder; }
 
     std::shared_ptr<ObjectMap> createEventProperties(const std::string& handler, const Object& value) const;
@@ -1260,6 +1312,26 @@ private:
 
     std::vector<ChildChange>         mChildrenChanges;
 
+    // Visual context entries produced by this subtree on the last serialization, along with the
+    // inputs used to produce them.  Dropped whenever this component or a descendant marks the
+    // visual context dirty.
+    struct VisualContextCache {
+        float realOpacity;
+        float visibility;
+        Rect visibleRect;
+        Rect globalBounds;
+        int visualLayer;
+        rapidjson::Document tags;
+        rapidjson::Document fragment;
+    };
+
+    std::unique_ptr<VisualContextCache> mVisualContextCache;
+
+    // Bounding boxes of the children, only built for components with many children.  Marked stale
+    // when a child is added, removed, moved, resized or transformed.
+    std::unique_ptr<ChildHitIndex>   mHitIndex;
+    bool                             mHitIndexStale = true;
+
     Transform2D                      mGlobalToLocal;
     bool                             mGlobalToLocalIsStale;
     Point                            mStickyOffset;
@@ -0,0 +1,308 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_DIRTY_PROPERTY_DECODER_H
+#define _APL_DIRTY_PROPERTY_DECODER_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * Header-only decoder for the binary dirty property format written by DirtyPropertyEncoder.
+ * This file has no dependencies on the rest of APL core so that it may be compiled into a
+ * view host on the far side of a JNI or IPC boundary.
+ *
+ * All values are written in host byte order.  A frame has the layout:
+ *
+ *     u32 magic ('APLD')  u16 version  u16 reserved  u32 componentCount
+ *     componentCount x {
+ *         u32 idLength  char[idLength] uniqueId
+ *         u32 propertyCount
+ *         propertyCount x { i32 propertyKey  u8 valueType  payload }
+ *     }
+ *
+ * The payload depends upon the value type:
+ *
+ *     kDirtyValueNull          (nothing)
+ *     kDirtyValueBoolean       u8
+ *     kDirtyValueNumber        f64
+ *     kDirtyValueString        u32 length, char[length]
+ *     kDirtyValueColor         u32 RRGGBBAA
+ *     kDirtyValueRect          f32 x, y, width, height
+ *     kDirtyValueTransform2D   f32[6]
+ *     kDirtyValueStyledText    u32 length, char[length] text, u32 spanCount,
+ *                              spanCount x { u8 type, u32 start, u32 end, u32 attributeCount,
+ *                                            attributeCount x { u8 name, u8 valueType, payload } }
+ *     kDirtyValueJson          u32 length, char[length] (the JSON serialization of the value)
+ *
+ * Span offsets are measured in code points, exactly as in the JSON serialization of StyledText.
+ */
+namespace apl {
+
+static const uint32_t DIRTY_PROPERTY_MAGIC = 0x444c5041;  // "APLD" in little-endian byte order
+static const uint16_t DIRTY_PROPERTY_VERSION = 1;
+
+enum DirtyValueType : uint8_t {
+    kDirtyValueNull = 0,
+    kDirtyValueBoolean = 1,
+    kDirtyValueNumber = 2,
+    kDirtyValueString = 3,
+    kDirtyValueColor = 4,
+    kDirtyValueRect = 5,
+    kDirtyValueTransform2D = 6,
+    kDirtyValueStyledText = 7,
+    kDirtyValueJson = 8,
+};
+
+/**
+ * A single decoded property value.  Only the fields appropriate to the type are set.
+ */
+struct DirtyValue {
+    /**
+     * A styled text span attribute.  Attribute values are always scalars: null, boolean, number,
+     * string, color or JSON.
+     */
+    struct Attribute {
+        uint8_t name = 0;
+        DirtyValueType type = kDirtyValueNull;
+        bool boolean = false;
+        double number = 0;
+        uint32_t color = 0;
+        std::string string;
+    };
+
+    struct Span {
+        uint8_t type = 0;
+        uint32_t start = 0;
+        uint32_t end = 0;
+        std::vector<Attribute> attributes;
+    };
+
+    DirtyValueType type = kDirtyValueNull;
+    bool boolean = false;
+    double number = 0;
+    uint32_t color = 0;
+    float data[6] = {0, 0, 0, 0, 0, 0};  // Rect (x, y, width, height) or Transform2D
+    std::string string;                   // String, StyledText text, or JSON
+    std::vector<Span> spans;
+};
+
+/**
+ * Sequential reader for a single encoded frame.
+ *
+ *     DirtyPropertyDecoder decoder(data, size);
+ *     std::string uid;
+ *     uint32_t count;
+ *     while (decoder.nextComponent(uid, count)) {
+ *         int key;
+ *         DirtyValue value;
+ *         for (uint32_t i = 0 ; i < count && decoder.nextProperty(key, value) ; i++)
+ *             ...
+ *     }
+ *     if (decoder.failed()) ...
+ *
+ * All read methods return false and set the failed flag if the buffer is truncated or malformed.
+ */
+class DirtyPropertyDecoder {
+public:
+    DirtyPropertyDecoder(const uint8_t *data, size_t size) : mPtr(data), mEnd(data + size) {
+        uint32_t magic = 0;
+        uint16_t version = 0, reserved = 0;
+        if (!read(magic) || !read(version) || !read(reserved) || !read(mComponentCount) ||
+            magic != DIRTY_PROPERTY_MAGIC || version != DIRTY_PROPERTY_VERSION)
+            mFailed = true;
+    }
+
+    explicit DirtyPropertyDecoder(const std::vector<uint8_t>& buffer)
+        : DirtyPropertyDecoder(buffer.data(), buffer.size()) {}
+
+    /**
+     * @return The number of components in this frame
+     */
+    uint32_t componentCount() const { return mComponentCount; }
+
+    /**
+     * @return True if the buffer could not be decoded
+     */
+    bool failed() const { return mFailed; }
+
+    /**
+     * Advance to the next component.  Any unread properties of the previous component are skipped.
+     * @param uniqueId Set to the unique id of the component
+     * @param propertyCount Set to the number of properties that follow
+     * @return True if a component was read
+     */
+    bool nextComponent(std::string& uniqueId, uint32_t& propertyCount) {
+        DirtyValue scratch;
+        int key;
+        while (mPropertiesRemaining > 0)
+            if (!nextProperty(key, scratch))
+                return false;
+
+        if (mFailed || mComponentsRead >= mComponentCount)
+            return false;
+
+        if (!readString(uniqueId) || !read(propertyCount))
+            return false;
+
+        mComponentsRead++;
+        mPropertiesRemaining = propertyCount;
+        return true;
+    }
+
+    /**
+     * Read the next property of the current component
+     * @param key Set to the PropertyKey of the property
+     * @param value Set to the decoded property value
+     * @return True if a property was read
+     */
+    bool nextProperty(int& key, DirtyValue& value) {
+        if (mFailed || mPropertiesRemaining == 0)
+            return false;
+
+        int32_t k;
+        if (!read(k) || !readValue(value))
+            return false;
+
+        key = k;
+        mPropertiesRemaining--;
+        return true;
+    }
+
+private:
+    template<typename T>
+    bool read(T& value) {
+        if (mFailed || static_cast<size_t>(mEnd - mPtr) < sizeof(T))
+            return fail();
+        std::memcpy(&value, mPtr, sizeof(T));
+        mPtr += sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string& value) {
+        uint32_t length;
+        if (!read(length) || static_cast<size_t>(mEnd - mPtr) < length)
+            return fail();
+        value.assign(reinterpret_cast<const char *>(mPtr), length);
+        mPtr += length;
+        return true;
+    }
+
+    bool readValue(DirtyValue& value) {
+        uint8_t type;
+        if (!read(type))
+            return false;
+
+        value.type = static_cast<DirtyValueType>(type);
+        value.spans.clear();
+
+        switch (value.type) {
+            case kDirtyValueNull:
+                return true;
+            case kDirtyValueBoolean: {
+                uint8_t b;
+                if (!read(b))
+                    return false;
+                value.boolean = b != 0;
+                return true;
+            }
+            case kDirtyValueNumber:
+                return read(value.number);
+            case kDirtyValueColor:
+                return read(value.color);
+            case kDirtyValueRect:
+                return read(value.data[0]) && read(value.data[1]) && read(value.data[2]) && read(value.data[3]);
+            case kDirtyValueTransform2D:
+                for (auto& f : value.data)
+                    if (!read(f))
+                        return false;
+                return true;
+            case kDirtyValueString:
+            case kDirtyValueJson:
+                return readString(value.string);
+            case kDirtyValueStyledText:
+                return readStyledText(value);
+        }
+
+        return fail();
+    }
+
+    bool readStyledText(DirtyValue& value) {
+        uint32_t spanCount;
+        if (!readString(value.string) || !read(spanCount))
+            return false;
+
+        for (uint32_t i = 0 ; i < spanCount ; i++) {
+            DirtyValue::Span span;
+            uint32_t attributeCount;
+            if (!read(span.type) || !read(span.start) || !read(span.end) || !read(attributeCount))
+                return false;
+            for (uint32_t j = 0 ; j < attributeCount ; j++) {
+                DirtyValue::Attribute attribute;
+                if (!read(attribute.name) || !readAttributeValue(attribute))
+                    return false;
+                span.attributes.emplace_back(std::move(attribute));
+            }
+            value.spans.emplace_back(std::move(span));
+        }
+        return true;
+    }
+
+    bool readAttributeValue(DirtyValue::Attribute& attribute) {
+        uint8_t type;
+        if (!read(type))
+            return false;
+
+        attribute.type = static_cast<DirtyValueType>(type);
+        switch (attribute.type) {
+            case kDirtyValueNull:
+                return true;
+            case kDirtyValueBoolean: {
+                uint8_t b;
+                if (!read(b))
+                    return false;
+                attribute.boolean = b != 0;
+                return true;
+            }
+            case kDirtyValueNumber:
+                return read(attribute.number);
+            case kDirtyValueColor:
+                return read(attribute.color);
+            case kDirtyValueString:
+            case kDirtyValueJson:
+                return readString(attribute.string);
+            default:
+                return fail();
+        }
+    }
+
+    bool fail() {
+        mFailed = true;
+        return false;
+    }
+
+    const uint8_t *mPtr;
+    const uint8_t *mEnd;
+    uint32_t mComponentCount = 0;
+    uint32_t mComponentsRead = 0;
+    uint32_t mPropertiesRemaining = 0;
+    bool mFailed = false;
+};
+
+} // namespace apl
+
+#endif // _APL_DIRTY_PROPERTY_DECODER_H
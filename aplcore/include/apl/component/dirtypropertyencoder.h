@@ -0,0 +1,76 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_DIRTY_PROPERTY_ENCODER_H
+#define _APL_DIRTY_PROPERTY_ENCODER_H
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "apl/common.h"
+#include "apl/component/dirtypropertydecoder.h"
+
+namespace apl {
+
+class Object;
+
+/**
+ * Encodes the dirty properties of a set of components into a single contiguous binary buffer.
+ * This is an alternative to calling Component::serializeDirty on each component; the view host
+ * reads the buffer with DirtyPropertyDecoder.  See dirtypropertydecoder.h for the format.
+ *
+ * A typical frame looks like:
+ *
+ *     auto& buffer = encoder.encode(root->getDirty());
+ *     sendToViewHost(buffer.data(), buffer.size());
+ *     root->clearDirty();
+ *
+ * The encoder retains its buffer between frames to avoid reallocation.  Encoding does not
+ * clear the dirty flags of the components.
+ */
+class DirtyPropertyEncoder {
+public:
+    /**
+     * Encode the dirty properties of the components.  The previous contents of the buffer are discarded.
+     * @param components The dirty components
+     * @return The encoded frame.  This reference is valid until the next call to encode().
+     */
+    const std::vector<uint8_t>& encode(const std::set<ComponentPtr>& components);
+
+    /**
+     * @return The most recently encoded frame
+     */
+    const std::vector<uint8_t>& buffer() const { return mBuffer; }
+
+private:
+    void encodeValue(const Object& value);
+    void encodeStyledText(const Object& value);
+    void encodeJson(const Object& value);
+    void putString(const std::string& value);
+
+    template<typename T>
+    void put(T value) {
+        auto offset = mBuffer.size();
+        mBuffer.resize(offset + sizeof(T));
+        std::memcpy(mBuffer.data() + offset, &value, sizeof(T));
+    }
+
+    std::vector<uint8_t> mBuffer;
+};
+
+} // namespace apl
+
+#endif // _APL_DIRTY_PROPERTY_ENCODER_H
@@ -43,6 +43,7 @@ public:
     void processLayoutChanges(bool useDirtyFlag, bool first) override;
     void accept(Visitor<CoreComponent>& visitor) const override;
     void raccept(Visitor<CoreComponent>& visitor) const override;
+    void rsearch(SearchVisitor& visitor) const override;
     Point scrollPosition() const override;
     ScrollType scrollType() const override {
         return getCalculated(kPropertyScrollDirection) == kScrollDirectionVertical ?
@@ -100,6 +100,7 @@ protected:
     const EventPropertyMap & eventPropertyMap() const override;
     void accept(Visitor<CoreComponent>& visitor) const override;
     void raccept(Visitor<CoreComponent>& visitor) const override;
+    void rsearch(SearchVisitor& visitor) const override;
     bool insertChild(const CoreComponentPtr& child, size_t index, bool useDirtyFlag) override;
     void removeChildAfterMarkedRemoved(const CoreComponentPtr& child, size_t index, bool useDirtyFlag) override;
     bool shouldAttachChildYogaNode(int index) const override;
@@ -36,7 +36,7 @@ public:
     void updateMediaState(const MediaState& state, bool fromEvent) override;
     bool getTags(rapidjson::Value& outMap, rapidjson::Document::AllocatorType& allocator) override;
 
-    rapidjson::Value serialize(rapidjson::Document::AllocatorType& allocator) const override;
+    void serializeExtra(rapidjson::Value& out, rapidjson::Document::AllocatorType& allocator) const override;
 
     std::string getCurrentUrl() const;
 
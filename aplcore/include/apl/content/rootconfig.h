@@ -83,6 +83,14 @@ public:
         kScreenModeHighContrast
     };
 
+    enum TimerBackend {
+        /// Pending timeouts are kept in a binary heap
+        kTimerBackendHeap,
+        /// Pending timeouts are kept in a hierarchical timer wheel.  Setting and clearing a
+        /// timeout take constant time.
+        kTimerBackendWheel
+    };
+
     enum ExperimentalFeature {
         /// Mark EditText component dirty if text updated
         kExperimentalFeatureMarkEditTextDirtyOnUpdate,
@@ -231,6 +239,15 @@ public:
         return *this;
     }
 
+    /**
+     * Replace the time manager with the standard time manager using the selected storage for
+     * pending timeouts.  Use this instead of timeManager() when the view host does not supply its
+     * own time manager.
+     * @param backend The timeout storage.
+     * @return This object for chaining.
+     */
+    RootConfig& timerBackend(TimerBackend backend);
+
     /**
      * Specify the runtime specific locale methods.
      * @param localeMethods The runtime implemented localeMethods
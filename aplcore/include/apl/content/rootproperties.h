@@ -141,6 +141,8 @@ enum RootProperty {
     kSendEventAdditionalFlags,
     /// Limit of cache records for TextMeasurements
     kTextMeasurementCacheLimit,
+    /// Limit of compiled data-binding expressions cached per document.  Zero disables the cache.
+    kExpressionCacheLimit,
     /// Initial display state of the document, used by core prior to any display state updates
     kInitialDisplayState,
     /// The End key marks the end of the enum members.
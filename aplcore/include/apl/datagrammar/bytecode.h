@@ -282,6 +282,7 @@ public:
     friend class ByteCodeAssembler;
     friend class ByteCodeOptimizer;
     friend class ByteCodeEvaluator;
+    friend class ByteCodeTemplate;
 
     class ObjectType final : public EvaluableObjectType<ByteCode> {
     public:
@@ -17,6 +17,7 @@
 #define _APL_BYTE_CODE_ASSEMBLER_H
 
 #include "apl/datagrammar/bytecode.h"
+#include "apl/datagrammar/bytecodetemplate.h"
 
 namespace apl {
 namespace datagrammar {
@@ -57,7 +58,8 @@ class ByteCodeAssembler {
 public:
     /**
      * Parse a string for data-binding expressions and return the result.  The result may
-     * be byte code or a simple object.
+     * be byte code or a simple object.  Parsed expressions are cached per document and only
+     * linked to the context on a cache hit.
      * @param context The data-binding context
      * @param value The string to parse
      * @return The calculated result
@@ -70,7 +72,7 @@ public:
     bool canDeferAndEval() const { return mCanDeferAndEval; }
 
 private:
-    Object retrieve() const;
+    ByteCodeTemplatePtr retrieve() const;
 
     /*** Methods after this point are for use by the PEGTL parser ***/
 
@@ -79,6 +81,7 @@ private:
     void loadConstant(ByteCodeConstant value);
     void loadImmediate(bciValueType value);
     void loadGlobal(const std::string& name);
+    void loadDimension(const std::string& value);
 
     void pushAttributeName(const std::string &name);
     void loadAttribute();
@@ -140,8 +143,6 @@ private:
     std::string toString() const;
     bool deferred() const { return mDeferredDepth > 0; }
 
-    ContextPtr context() const { return mContext; }
-
     template<class T> friend struct action;
 
 public:
@@ -152,21 +153,19 @@ public:
     };
 
 private:
-    explicit ByteCodeAssembler(const Context& context);
+    ByteCodeAssembler();
 
 private:
     struct CodeUnit {
-        explicit CodeUnit(const ContextPtr& context)
-            : byteCode(std::make_shared<ByteCode>(context)) {}
+        CodeUnit() : byteCode(std::make_shared<ByteCodeTemplate>()) {}
 
-        std::shared_ptr<ByteCode> byteCode;
+        ByteCodeTemplatePtr byteCode;
         std::vector<Operator> operators;     // Operator stack
     };
 
-    ContextPtr mContext;
     CodeUnit mCode;
 
-    // Convenience references so we don't keep dereferencing the ByteCode
+    // Convenience references so we don't keep dereferencing the ByteCodeTemplate
     std::vector<ByteCodeInstruction>* mInstructionRef;
     std::vector<Object>* mDataRef;
     std::vector<Operator>* mOperatorsRef;
@@ -0,0 +1,65 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_BYTE_CODE_TEMPLATE_H
+#define _APL_BYTE_CODE_TEMPLATE_H
+
+#include <string>
+#include <vector>
+
+#include "apl/datagrammar/bytecode.h"
+
+namespace apl {
+namespace datagrammar {
+
+/**
+ * A parsed data-binding expression that has not been tied to a context.
+ *
+ * The byte code assembler produces a template instead of byte code.  Everything that depends on
+ * the context (global symbols and relative dimensions) is left as a placeholder.  Linking the
+ * template fills in the placeholders exactly the way the assembler used to, so the same template
+ * can be reused for every context in a document.  This is what makes the expression cache cheap:
+ * the items of a multi-child component share their expressions and only the first one is parsed.
+ */
+class ByteCodeTemplate {
+public:
+    /**
+     * Create byte code for a context.
+     * @param context The data-binding context.
+     * @return The byte code.
+     */
+    std::shared_ptr<ByteCode> link(const Context& context) const;
+
+    friend class ByteCodeAssembler;
+
+private:
+    struct Placeholder {
+        bool global;                // True for a global symbol, false for a dimension
+        std::string text;           // Symbol name or dimension string
+        bciValueType dataIndex;
+        size_t instructionIndex;    // Only used for global symbols
+    };
+
+    std::vector<ByteCodeInstruction> mInstructions;
+    std::vector<Object> mData;
+    std::vector<Placeholder> mPlaceholders;
+};
+
+using ByteCodeTemplatePtr = std::shared_ptr<ByteCodeTemplate>;
+
+} // namespace datagrammar
+} // namespace apl
+
+#endif // _APL_BYTE_CODE_TEMPLATE_H
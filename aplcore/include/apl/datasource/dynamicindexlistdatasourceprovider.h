@@ -55,6 +55,16 @@ enum DynamicIndexListUpdateType {
     kTypeDeleteMultiple = 4,
 };
 
+/**
+ * Single update operation as read from an update payload.
+ */
+struct DynamicIndexListUpdate {
+    DynamicIndexListUpdateType type;
+    int index;
+    Object data;
+    int count;
+};
+
 class DynamicIndexListDataSourceProvider;
 class DynamicIndexListDataSourceConnection;
 
@@ -116,6 +126,15 @@ public:
      */
     bool processUpdate(DynamicIndexListUpdateType type, int index, const Object& data, int count);
 
+    /**
+     * Apply a run of update operations as a single LiveArray change. A run is a series of inserts
+     * at consecutive indexes, removals at the same index or replacements at consecutive indexes.
+     * Nothing is changed unless the whole run is in range.
+     * @param updates operations of the run, in payload order.
+     * @return true if the run was applied, false if it should be applied one operation at a time.
+     */
+    bool processUpdateRun(const std::vector<DynamicIndexListUpdate>& updates);
+
     /**
      * Process lazy loading response.
      * Performs adjustments required to match source parameters to internal implementation.
@@ -169,6 +188,7 @@ public:
 protected:
     /// Override to convert internal->source specific parameters.
     void fetch(size_t index, size_t count) override;
+    size_t evict(std::ptrdiff_t first, std::ptrdiff_t last) override;
 
 private:
     double mMinimumInclusiveIndex;
@@ -216,6 +236,9 @@ public:
      */
     std::pair<int, int> getBounds(const std::string& listId);
 
+protected:
+    std::string checkPayload(const Object& payload) const override;
+
 private:
     bool processLazyLoadInternal(const DILConnectionPtr& connection,
             const Object& responseMap);
@@ -34,6 +34,8 @@ static const int DEFAULT_FETCH_TIMEOUT_MS = 5000;
 static const int DEFAULT_MAX_LIST_UPDATE_BUFFER = 5;
 /// Cache expiry timeout.
 static const int DEFAULT_CACHE_EXPIRY_TIMEOUT_MS = 5000;
+/// Maximum number of outstanding fetch requests per list. 0 means no limit.
+static const size_t DEFAULT_MAX_PENDING_FETCHES = 0;
 
 // Directive content keys
 static const std::string LIST_ID = "listId";
@@ -75,6 +77,9 @@ public:
     DynamicListConfiguration& setFetchRetries(int v) { fetchRetries = v; return *this; }
     DynamicListConfiguration& setFetchTimeout(apl_duration_t v) { fetchTimeout = v; return *this; }
     DynamicListConfiguration& setCacheExpiryTimeout(apl_duration_t v) { cacheExpiryTimeout = v; return *this; }
+    DynamicListConfiguration& setMaxCacheChunkSize(size_t v) { maxCacheChunkSize = v; return *this; }
+    DynamicListConfiguration& setMaxPendingFetches(size_t v) { maxPendingFetches = v; return *this; }
+    DynamicListConfiguration& setEvictionDistance(size_t v) { evictionDistance = v; return *this; }
 
     /// Source type name.
     std::string type;
@@ -88,6 +93,13 @@ public:
     int listUpdateBufferSize = DynamicListConstants::DEFAULT_MAX_LIST_UPDATE_BUFFER;
     /// Cached updates expiry timeout in milliseconds.
     apl_duration_t cacheExpiryTimeout = DynamicListConstants::DEFAULT_CACHE_EXPIRY_TIMEOUT_MS;
+    /// Largest fetch chunk when scrolling quickly. Values not above cacheChunkSize disable the adaptive window.
+    size_t maxCacheChunkSize = 0;
+    /// Maximum number of outstanding fetch requests. 0 means no limit.
+    size_t maxPendingFetches = DynamicListConstants::DEFAULT_MAX_PENDING_FETCHES;
+    /// Loaded items further than this many items from the ones on screen are dropped and fetched again when needed.
+    /// 0 keeps every loaded item.
+    size_t evictionDistance = 0;
 };
 
 } // namespace apl
@@ -19,6 +19,7 @@
 #include "apl/common.h"
 #include "apl/datasource/datasourceprovider.h"
 #include "apl/datasource/dynamiclistdatasourcecommon.h"
+#include "apl/datasource/fetchscheduler.h"
 #include "apl/datasource/offsetindexdatasourceconnection.h"
 #include "apl/primitives/object.h"
 #include "apl/utils/noncopyable.h"
@@ -104,6 +105,14 @@ public:
      */
     void setContext(const ContextPtr& context) { mContext = context; }
 
+    /**
+     * @return Fetch scheduling counters and the current scroll velocity and latency estimates.
+     */
+    const FetchSchedulerStats& getFetchStats() const { return mScheduler.stats(); }
+
+    /// DataSourceConnection overrides
+    void ensure(size_t index) override;
+
 protected:
     /**
      * Retry fetch request.
@@ -111,7 +120,40 @@ protected:
      */
     bool retryFetchRequest(const std::string& correlationToken);
 
-    void sendFetchRequest(const ObjectMap& requestData);
+    /**
+     * Send a fetch request unless an identical one is already pending.
+     * @return Correlation token of the request sent, or an empty string if none was sent.
+     */
+    std::string sendFetchRequest(const ObjectMap& requestData);
+    size_t prefetchWindow(bool forward) const override { return mScheduler.window(forward); }
+    apl_time_t currentTime() const;
+
+    /**
+     * Remember that an item is on screen.  When eviction is enabled, items far from the ones on
+     * screen are dropped shortly afterwards, outside of the layout pass.
+     * @param index Index of the item in the LiveArray.
+     */
+    void trackEnsured(size_t index);
+
+    /**
+     * @param index Index of an item in the LiveArray.
+     * @return Position of the item that does not change when items are added or dropped at the start.
+     */
+    virtual std::ptrdiff_t sourcePosition(size_t index) const { return mOffset + index; }
+
+    /**
+     * Drop loaded items outside of a range of positions.
+     * @param first First position to keep.
+     * @param last Last position to keep.
+     * @return Number of items dropped.
+     */
+    virtual size_t evict(std::ptrdiff_t first, std::ptrdiff_t last) { return 0; }
+
+    /**
+     * @return true if any fetch request is waiting for a response.
+     */
+    bool hasPendingFetches() const { return !mPendingFetchRequests.empty(); }
+
     void clearTimeouts(const ContextPtr& context, const std::string& correlationToken);
     timeout_id scheduleUpdateExpiry(int version);
     void reportUpdateExpired(int version);
@@ -120,10 +162,12 @@ protected:
 
     std::weak_ptr<Context> mContext;
     DynamicListConfiguration mConfiguration;
+    FetchScheduler mScheduler;
 
 private:
     void enqueueFetchRequestEvent(const ContextPtr& context, const ObjectMapPtr& request);
     timeout_id scheduleTimeout(const std::string& correlationToken);
+    void runEviction();
 
     /**
      * Internal Utility to keep fetch request related information.
@@ -151,6 +195,50 @@ private:
     std::string mListId;
     DLProviderWPtr mProvider;
     int mListVersion;
+
+    // Positions ensured since the last eviction pass, and in the pass before it
+    bool mEnsuredAny = false;
+    std::ptrdiff_t mEnsuredLow = 0;
+    std::ptrdiff_t mEnsuredHigh = 0;
+    bool mPreviousAny = false;
+    std::ptrdiff_t mPreviousLow = 0;
+    std::ptrdiff_t mPreviousHigh = 0;
+    timeout_id mEvictionTimeout = 0;
+};
+
+/**
+ * Update payload parsed and checked by DynamicListDataSourceProvider::prepareUpdate, possibly on a
+ * thread other than the engine one.  Pass it to DynamicListDataSourceProvider::processUpdate on the
+ * engine thread to apply it.
+ */
+class PreparedListUpdate {
+public:
+    /**
+     * @return true if the payload was valid JSON.
+     */
+    bool parsed() const { return !mPayload.isNull(); }
+
+    /**
+     * @return true if the payload passed every check that does not depend on the state of the list.
+     */
+    bool valid() const { return parsed() && mError.empty(); }
+
+    /**
+     * @return ID of the list the update is for, or an empty string if the payload has none.
+     */
+    const std::string& getListId() const { return mListId; }
+
+    /**
+     * @return Description of the first problem found, or an empty string.
+     */
+    const std::string& getError() const { return mError; }
+
+private:
+    friend class DynamicListDataSourceProvider;
+
+    Object mPayload;
+    std::string mListId;
+    std::string mError;
 };
 
 class DynamicListDataSourceProvider : public DataSourceProvider {
@@ -169,6 +257,38 @@ public:
     bool processUpdate(const Object& payload) override;
     std::string getType() const override { return mConfiguration.type; }
 
+    /**
+     * Parse an update payload into ready to apply data and check everything that does not depend on
+     * the state of the list: list ID, field types and item shapes.  Does not touch any list or
+     * document, so it may be called on any thread, including while the engine is running.
+     * @param payload Raw JSON bytes.
+     * @param length Number of bytes.
+     * @return Prepared update.
+     */
+    PreparedListUpdate prepareUpdate(const char *payload, size_t length) const;
+
+    /**
+     * @param payload Raw JSON payload.
+     * @return Prepared update.
+     */
+    PreparedListUpdate prepareUpdate(const std::string& payload) const {
+        return prepareUpdate(payload.data(), payload.size());
+    }
+
+    /**
+     * Apply an update returned by prepareUpdate.  Must be called on the engine thread.  Errors are
+     * reported the same way as for an unprepared payload.
+     * @param update Prepared update.
+     * @return true if the update was applied, false otherwise.
+     */
+    bool processUpdate(const PreparedListUpdate& update);
+
+    /**
+     * @param listId ID of list requested.
+     * @return Fetch scheduling statistics for the list, or empty statistics if there is no such list.
+     */
+    FetchSchedulerStats getFetchStats(const std::string& listId);
+
 protected:
     DLConnectionPtr getConnection(const std::string& listId);
     DLConnectionPtr getConnection(const std::string& listId, const Object& correlationToken);
@@ -201,6 +321,14 @@ protected:
         const std::string& listId) = 0;
     virtual bool process(const Object& responseMap) = 0;
 
+    /**
+     * Check a parsed payload for problems that do not depend on the state of the list.  Called by
+     * prepareUpdate, possibly on another thread, so it must not touch connections or documents.
+     * @param payload Parsed payload.
+     * @return Description of the first problem found, or an empty string.
+     */
+    virtual std::string checkPayload(const Object& payload) const;
+
     DynamicListConfiguration mConfiguration;
 
 private:
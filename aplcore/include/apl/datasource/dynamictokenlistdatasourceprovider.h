@@ -16,6 +16,8 @@
 #ifndef _APL_DYNAMIC_TOKEN_LIST_DATA_SOURCE_PROVIDER_H
 #define _APL_DYNAMIC_TOKEN_LIST_DATA_SOURCE_PROVIDER_H
 
+#include <deque>
+
 #include "apl/datasource/dynamiclistdatasourceprovider.h"
 
 namespace apl {
@@ -47,7 +49,8 @@ public:
         std::weak_ptr<LiveArray> liveArray,
         const std::string& listId,
         const Object& firstToken,
-        const Object& lastToken);
+        const Object& lastToken,
+        const Object& pageToken = Object::NULL_OBJECT());
 
     /**
      * Process lazy loading response.
@@ -75,12 +78,39 @@ public:
 protected:
     /// Override fetch not used in this class
     void fetch(size_t index, size_t count) override { return; };
+    std::ptrdiff_t sourcePosition(size_t index) const override { return static_cast<std::ptrdiff_t>(index) - mPrepended; }
+    size_t evict(std::ptrdiff_t first, std::ptrdiff_t last) override;
 
 private:
+    /**
+     * A page of loaded items.  The token is the one the page was requested with, so an evicted
+     * page can be fetched again.  Pages without a token are never evicted.
+     */
+    struct Page {
+        Object token;
+        size_t size;
+    };
+
+    /**
+     * An evicted page.  A page fetched in one direction may be evicted from the other end of the
+     * list, so the next page token of its response is not the token to continue with.  Once the
+     * page is loaded again the end token goes back to the one it had before the eviction.
+     */
+    struct Evicted {
+        Object token;
+        Object restore;
+    };
+
     Object mFirstToken;
     Object mLastToken;
+    Object mPageToken;
+    std::deque<Page> mPages;
+    std::vector<Evicted> mEvictedFirst;
+    std::vector<Evicted> mEvictedLast;
+    std::ptrdiff_t mPrepended = 0; // Items loaded before the initial ones
 
     bool updateLiveArray(const std::vector<Object>& data, const Object& pageToken, const Object& nextPageToken);
+    static Object restoreToken(std::vector<Evicted>& evicted, const Object& pageToken, const Object& nextPageToken);
 };
 
 class DynamicTokenListDataSourceProvider : public DynamicListDataSourceProvider,
@@ -104,6 +134,9 @@ public:
         const std::string& listId) override;
     bool process(const Object& responseMap) override;
 
+protected:
+    std::string checkPayload(const Object& payload) const override;
+
 private:
     bool processLazyLoadInternal(const DTLConnectionPtr& connection, const Object& responseMap);
 };
@@ -0,0 +1,170 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_FETCH_SCHEDULER_H
+#define _APL_FETCH_SCHEDULER_H
+
+#include <string>
+#include <vector>
+
+#include "apl/common.h"
+
+namespace apl {
+
+/**
+ * Counters and estimates reported by a FetchScheduler.  Intended for tuning the dynamic list
+ * configuration.
+ */
+struct FetchSchedulerStats {
+    /// Number of fetches the connection asked for.
+    size_t requested = 0;
+    /// Number of fetch requests sent.
+    size_t issued = 0;
+    /// Number of fetches dropped or trimmed because an outstanding request already covered them.
+    size_t coalesced = 0;
+    /// Number of fetches deferred because too many requests were outstanding.
+    size_t throttled = 0;
+    /// Number of requests answered.
+    size_t completed = 0;
+    /// Number of loaded items dropped because they were far from the items on screen.
+    size_t evicted = 0;
+    /// Smoothed scroll velocity in items per millisecond.  Negative when moving toward the start.
+    double velocity = 0;
+    /// Smoothed time between sending a request and receiving its response, in milliseconds.
+    double latency = 0;
+};
+
+/**
+ * Decides how far beyond the ensured item a dynamic list should fetch, and keeps track of the
+ * index ranges that are already in flight.
+ *
+ * The window in the direction of scrolling grows with scroll velocity times response latency, so
+ * that a response has a chance to arrive before the user reaches the last loaded item.  The window
+ * never drops below the minimum (the configured cache chunk size) and never exceeds the maximum.
+ * When both are equal the scheduler only coalesces and caps requests.
+ */
+class FetchScheduler {
+public:
+    /**
+     * @param minimumWindow Smallest number of items to keep loaded beyond the ensured one.
+     * @param maximumWindow Largest number of items to keep loaded beyond the ensured one.
+     * @param maximumPending Maximum number of outstanding requests, or 0 for no limit.
+     */
+    FetchScheduler(size_t minimumWindow, size_t maximumWindow, size_t maximumPending);
+
+    /**
+     * Record that the item at a source index was ensured.
+     * @param index Index of the item in the source.
+     * @param now Current time.
+     */
+    void ensured(size_t index, apl_time_t now);
+
+    /**
+     * @param forward True for the window after the loaded items, false for the one before them.
+     * @return Number of items to keep loaded beyond the ensured item in that direction.
+     */
+    size_t window(bool forward) const;
+
+    /**
+     * Trim a fetch range against the ranges already in flight and check the outstanding request
+     * limit.
+     * @param index Start of the range.  Updated if the start is already in flight.
+     * @param count Size of the range.  Updated if either end is already in flight.
+     * @return True if the trimmed range should be requested now.
+     */
+    bool admit(size_t& index, size_t& count);
+
+    /**
+     * Record a request that was sent.
+     * @param token Correlation token of the request.
+     * @param index Start of the requested range.
+     * @param count Size of the requested range.
+     * @param now Current time.
+     */
+    void issued(const std::string& token, size_t index, size_t count, apl_time_t now);
+
+    /**
+     * Record that a request was sent again under a new token.
+     */
+    void retried(const std::string& token, const std::string& newToken, apl_time_t now);
+
+    /**
+     * Record a response.  The latency estimate is updated from the most recent send time.
+     */
+    void completed(const std::string& token, apl_time_t now);
+
+    /**
+     * Forget a request that will not be retried.
+     */
+    void abandoned(const std::string& token);
+
+    /**
+     * Items were inserted or removed, so the ranges of the requests in flight no longer match the
+     * current indexes.  The requests still count as outstanding but no longer coalesce new ones.
+     */
+    void forgetRanges();
+
+    /**
+     * @param begin Start of a range.
+     * @param end End of the range (exclusive).
+     * @return True if a request in flight may deliver items in the range.
+     */
+    bool hasPendingIn(size_t begin, size_t end) const;
+
+    /**
+     * Record that loaded items were dropped.
+     * @param count Number of items.
+     */
+    void evicted(size_t count) { mStats.evicted += count; }
+
+    /**
+     * @return Number of requests in flight.
+     */
+    size_t pending() const { return mInFlight.size(); }
+
+    /**
+     * @return Counters and estimates.
+     */
+    const FetchSchedulerStats& stats() const { return mStats; }
+
+private:
+    struct InFlight {
+        size_t index;
+        size_t count;
+        apl_time_t sent;
+        std::vector<std::string> tokens;
+    };
+
+    std::vector<InFlight>::iterator find(const std::string& token);
+
+    size_t mMinimumWindow;
+    size_t mMaximumWindow;
+    size_t mMaximumPending;
+    std::vector<InFlight> mInFlight;
+    FetchSchedulerStats mStats;
+
+    // Scroll tracking.  The anchor is the middle of the items ensured in the previous frame; the
+    // frame values track the items ensured in the current one.
+    bool mTracking = false;
+    double mAnchorIndex = 0;
+    apl_time_t mAnchorTime = 0;
+    double mFrameLow = 0;
+    double mFrameHigh = 0;
+    apl_time_t mFrameTime = 0;
+};
+
+} // namespace apl
+
+#endif // _APL_FETCH_SCHEDULER_H
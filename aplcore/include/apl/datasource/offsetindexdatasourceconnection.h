@@ -116,6 +116,15 @@ protected:
      */
     virtual void fetch(size_t index, size_t count) = 0;
 
+    /**
+     * Number of items to keep loaded beyond the ensured index. Fetches are issued when fewer are
+     * available, and ask for this many items.
+     *
+     * @param forward true for the items after the loaded range, false for the items before it.
+     * @return window size, by default the cache chunk size.
+     */
+    virtual size_t prefetchWindow(bool forward) const { return mCacheChunkSize; }
+
 protected:
     size_t mMaxItems;
     size_t mOffset;
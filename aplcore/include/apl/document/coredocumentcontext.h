@@ -21,6 +21,7 @@
 #include "apl/document/displaystate.h"
 #include "apl/document/documentcontext.h"
 #include "apl/document/documentcontextdata.h"
+#include "apl/document/visualcontextsnapshot.h"
 
 #ifdef ALEXAEXTENSIONS
 #include "apl/extension/extensionmediator.h"
@@ -270,10 +271,14 @@ public:
     bool isVisualContextDirty() const override;
     void clearVisualContextDirty() override;
     rapidjson::Value serializeVisualContext(rapidjson::Document::AllocatorType& allocator) override;
+    void serializeVisualContext(JsonSink& sink) override;
+    rapidjson::Value serializeVisualContextDelta(rapidjson::Document::AllocatorType& allocator) override;
     bool isDataSourceContextDirty() const override;
     void clearDataSourceContextDirty() override;
     rapidjson::Value serializeDataSourceContext(rapidjson::Document::AllocatorType& allocator) override;
+    void serializeDataSourceContext(JsonSink& sink) override;
     rapidjson::Value serializeDOM(bool extended, rapidjson::Document::AllocatorType& allocator) override;
+    void serializeDOM(bool extended, JsonSink& sink) override;
     rapidjson::Value serializeContext(rapidjson::Document::AllocatorType& allocator) override;
     ActionPtr executeCommands(const Object& commands, bool fastMode) override;
 
@@ -301,6 +306,7 @@ private:
     ConfigurationChange mActiveConfigurationChanges;
     ConfigurationChange mResultingConfigurationChange;
     DisplayState mDisplayState;
+    VisualContextSnapshotPtr mVisualContextSnapshot;  // Only maintained once a delta is requested
 
     apl_time_t mUTCTime;
     apl_duration_t mLocalTimeAdjustment;
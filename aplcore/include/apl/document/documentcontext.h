@@ -19,6 +19,7 @@
 #include "apl/common.h"
 #include "apl/primitives/object.h"
 #include "apl/utils/counter.h"
+#include "apl/utils/jsonsink.h"
 #include "apl/utils/noncopyable.h"
 
 namespace apl {
@@ -49,6 +50,31 @@ public:
      */
     virtual rapidjson::Value serializeVisualContext(rapidjson::Document::AllocatorType& allocator) = 0;
 
+    /**
+     * Stream the visual context into a JSON sink. The output is identical to
+     * serializeVisualContext(allocator).  This method also clears the visual context dirty flag.
+     * @param sink The destination for the JSON output
+     */
+    virtual void serializeVisualContext(JsonSink& sink) = 0;
+
+    /**
+     * Retrieve the changes to the visual context since the last call to serializeVisualContext or
+     * serializeVisualContextDelta.  The delta is a JSON object of the form:
+     *
+     *     {
+     *       "root": UID,
+     *       "updated": [ ENTRY, ... ],
+     *       "removed": [ UID, ... ]
+     *     }
+     *
+     * Each entry in "updated" is the visual context of a single component that is new or has
+     * changed, with its "children" member replaced by the list of child unique ids.  The first
+     * call reports every component.  This method also clears the visual context dirty flag.
+     * @param allocator Rapidjson allocator
+     * @return The serialized visual context delta
+     */
+    virtual rapidjson::Value serializeVisualContextDelta(rapidjson::Document::AllocatorType& allocator) = 0;
+
     /**
      * Identifies when the datasource context may have changed.  A call to serializeDatasourceContext resets this value to false.
      * @return true if the datasource context has changed since the last call to serializeDatasourceContext, false otherwise.
@@ -68,6 +94,14 @@ public:
      */
     virtual rapidjson::Value serializeDataSourceContext(rapidjson::Document::AllocatorType& allocator) = 0;
 
+    /**
+     * Stream the datasource context into a JSON sink. The output is identical to
+     * serializeDataSourceContext(allocator). This method also clears the datasource context
+     * dirty flag.
+     * @param sink The destination for the JSON output
+     */
+    virtual void serializeDataSourceContext(JsonSink& sink) = 0;
+
     /**
      * Serialize a complete version of the DOM
      * @param extended If true, serialize everything.  If false, just serialize external data
@@ -76,6 +110,14 @@ public:
      */
     virtual rapidjson::Value serializeDOM(bool extended, rapidjson::Document::AllocatorType& allocator) = 0;
 
+    /**
+     * Stream a complete version of the DOM into a JSON sink.  The output is identical to
+     * serializeDOM(extended, allocator), but the full DOM is never held in memory.
+     * @param extended If true, serialize everything.  If false, just serialize external data
+     * @param sink The destination for the JSON output
+     */
+    virtual void serializeDOM(bool extended, JsonSink& sink) = 0;
+
     /**
      * Serialize the global values for developer tools
      * @param allocator Rapidjson allocator
@@ -41,6 +41,10 @@ class UIDManager;
 class DataSourceConnection;
 using DataSourceConnectionPtr = std::shared_ptr<DataSourceConnection>;
 
+namespace datagrammar {
+class ByteCodeTemplate;
+}
+
 /**
  * Data contained in the rendered document.
  */
@@ -132,6 +136,13 @@ public:
      */
     LruCache<TextMeasureRequest, float>& cachedBaselines();
 
+    /**
+     * @return Cache of parsed data-binding expressions, or nullptr if caching is disabled.
+     */
+    LruCache<std::string, std::shared_ptr<datagrammar::ByteCodeTemplate>>* expressionCache() {
+        return mExpressionCache.get();
+    }
+
     /**
      * @return List of pending onMount handlers for recently inflated components.
      */
@@ -186,6 +197,8 @@ private:
     CoreComponentPtr mTop;
     SessionPtr mSession;
     WeakPtrSet<CoreComponent> mPendingOnMounts;
+    // Parsed expressions depend on the document version, so the cache is not shared between documents
+    std::unique_ptr<LruCache<std::string, std::shared_ptr<datagrammar::ByteCodeTemplate>>> mExpressionCache;
     std::set<ComponentPtr> mDirtyVisualContext;
     std::set<DataSourceConnectionPtr> mDirtyDatasourceContext;
 #ifdef ALEXAEXTENSIONS
@@ -0,0 +1,79 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_VISUAL_CONTEXT_SNAPSHOT_H
+#define _APL_VISUAL_CONTEXT_SNAPSHOT_H
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "rapidjson/document.h"
+
+namespace apl {
+
+class VisualContextSnapshot;
+using VisualContextSnapshotPtr = std::unique_ptr<VisualContextSnapshot>;
+
+/**
+ * Flattened copy of a serialized visual context, indexed by component unique id.  Each entry
+ * holds the serialized visual context of a single component with its "children" member
+ * replaced by the list of child unique ids.  Two snapshots can be compared to produce the
+ * delta reported by DocumentContext::serializeVisualContextDelta().
+ */
+class VisualContextSnapshot {
+public:
+    /**
+     * Build a snapshot from a serialized visual context.
+     * @param visualContext The visual context as returned by serializeVisualContext.
+     * @return The snapshot.
+     */
+    static VisualContextSnapshotPtr create(const rapidjson::Value& visualContext);
+
+    /**
+     * Serialize the changes between a previous snapshot and this one.  The result has the form:
+     *
+     *     {
+     *       "root": UID,
+     *       "updated": [ ENTRY, ... ],
+     *       "removed": [ UID, ... ]
+     *     }
+     *
+     * where "updated" lists every flattened entry that is new or differs from the previous
+     * snapshot and "removed" lists the unique ids no longer present.
+     *
+     * @param previous The previous snapshot.  May be null, in which case every entry is reported.
+     * @param allocator RapidJSON memory allocator
+     * @return The serialized delta.
+     */
+    rapidjson::Value diff(const VisualContextSnapshot* previous,
+                          rapidjson::Document::AllocatorType& allocator) const;
+
+    /**
+     * @return The number of components in this snapshot.
+     */
+    size_t size() const { return mEntries.size(); }
+
+private:
+    void flatten(const rapidjson::Value& entry);
+
+    rapidjson::Document mDocument;
+    std::map<std::string, const rapidjson::Value*> mEntries;
+    std::string mRoot;
+};
+
+} // namespace apl
+
+#endif // _APL_VISUAL_CONTEXT_SNAPSHOT_H
@@ -55,7 +55,12 @@ class LayoutManager;
 class LiveDataManager;
 class UIDManager;
 
+namespace datagrammar {
+class ByteCodeTemplate;
+}
+
 using DataSourceConnectionPtr = std::shared_ptr<DataSourceConnection>;
+using ExpressionCache = LruCache<std::string, std::shared_ptr<datagrammar::ByteCodeTemplate>>;
 
 /*
  * The data-binding context holds information about the local environment, metrics, and resources.
@@ -601,6 +606,11 @@ public:
      */
     LruCache<TextMeasureRequest, float>& cachedBaselines();
 
+    /**
+     * @return Cache of parsed data-binding expressions, or nullptr if this context has none.
+     */
+    ExpressionCache* expressionCache() const;
+
     /**
      * @return List of pending onMount handlers for recently inflated components.
      */
@@ -67,10 +67,14 @@ public:
     bool isVisualContextDirty() const override;
     void clearVisualContextDirty() override;
     rapidjson::Value serializeVisualContext(rapidjson::Document::AllocatorType& allocator) override;
+    void serializeVisualContext(JsonSink& sink) override;
+    rapidjson::Value serializeVisualContextDelta(rapidjson::Document::AllocatorType& allocator) override;
     bool isDataSourceContextDirty() const override;
     void clearDataSourceContextDirty() override;
     rapidjson::Value serializeDataSourceContext(rapidjson::Document::AllocatorType& allocator) override;
+    void serializeDataSourceContext(JsonSink& sink) override;
     rapidjson::Value serializeDOM(bool extended, rapidjson::Document::AllocatorType& allocator) override;
+    void serializeDOM(bool extended, JsonSink& sink) override;
     rapidjson::Value serializeContext(rapidjson::Document::AllocatorType& allocator) override;
     APL_DEPRECATED ActionPtr executeCommands(const Object& commands, bool fastMode) override;
     ActionPtr invokeExtensionEventHandler(const std::string& uri, const std::string& name,
@@ -94,6 +98,7 @@ public:
     Info info() const override;
     void updateCursorPosition(Point cursorPosition) override;
     bool handlePointerEvent(const PointerEvent& pointerEvent) override;
+    bool handlePointerEvents(const std::vector<PointerSample>& samples) override;
     bool handleKeyboard(KeyHandlerType type, const Keyboard &keyboard) override;
     const RootConfig& getRootConfig() const override;
     std::string getTheme() const override;
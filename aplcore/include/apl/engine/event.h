@@ -22,6 +22,7 @@
 #include "apl/command/commandproperties.h"
 #include "apl/component/component.h"
 #include "apl/primitives/objectbag.h"
+#include "apl/utils/jsonsink.h"
 
 namespace apl {
 
@@ -364,6 +365,12 @@ public:
      */
     rapidjson::Value serialize(rapidjson::Document::AllocatorType& allocator) const;
 
+    /**
+     * Stream this event into a JSON sink.  The output is identical to serialize(allocator).
+     * @param sink The destination for the JSON output
+     */
+    void serialize(JsonSink& sink) const;
+
     /**
      * Equality test. Does not guarantee that it's the same event object, but contents are equal.
      */
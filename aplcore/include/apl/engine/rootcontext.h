@@ -25,6 +25,7 @@
 #include "apl/engine/info.h"
 #include "apl/focus/focusdirection.h"
 #include "apl/primitives/keyboard.h"
+#include "apl/utils/jsonsink.h"
 #include "apl/utils/noncopyable.h"
 #include "apl/utils/userdata.h"
 #ifdef SCENEGRAPH
@@ -42,6 +43,7 @@ class Metrics;
 class RootConfig;
 class TimeManager;
 struct PointerEvent;
+struct PointerSample;
 
 /**
  * Represents a top-level APL document.
@@ -220,6 +222,22 @@ public:
      */
     virtual rapidjson::Value serializeVisualContext(rapidjson::Document::AllocatorType& allocator) = 0;
 
+    /**
+     * Stream the top document's visual context into a JSON sink.  This method also clears the
+     * visual context dirty flag
+     * @param sink The destination for the JSON output
+     */
+    virtual void serializeVisualContext(JsonSink& sink) = 0;
+
+    /**
+     * Retrieve the changes to the top document's visual context since the last serialization.
+     * See DocumentContext::serializeVisualContextDelta for the format. This method also clears
+     * the visual context dirty flag
+     * @param allocator Rapidjson allocator
+     * @return The serialized visual context delta
+     */
+    virtual rapidjson::Value serializeVisualContextDelta(rapidjson::Document::AllocatorType& allocator) = 0;
+
     /**
      * Identifies when the datasource context for the top document may have changed.  A call to
      * serializeDatasourceContext resets this value to false.
@@ -241,6 +259,13 @@ public:
      */
     virtual rapidjson::Value serializeDataSourceContext(rapidjson::Document::AllocatorType& allocator) = 0;
 
+    /**
+     * Stream the top document's datasource context into a JSON sink. This method also clears the
+     * datasource context dirty flag
+     * @param sink The destination for the JSON output
+     */
+    virtual void serializeDataSourceContext(JsonSink& sink) = 0;
+
     /**
      * Serialize a complete version of the DOM
      * @param extended If true, serialize everything.  If false, just serialize external data
@@ -249,6 +274,13 @@ public:
      */
     virtual rapidjson::Value serializeDOM(bool extended, rapidjson::Document::AllocatorType& allocator) = 0;
 
+    /**
+     * Stream a complete version of the DOM into a JSON sink
+     * @param extended If true, serialize everything.  If false, just serialize external data
+     * @param sink The destination for the JSON output
+     */
+    virtual void serializeDOM(bool extended, JsonSink& sink) = 0;
+
     /**
      * Serialize the global values for developer tools
      * @param allocator Rapidjson allocator
@@ -369,6 +401,19 @@ public:
      */
     virtual bool handlePointerEvent(const PointerEvent& pointerEvent) = 0;
 
+    /**
+     * Handle the pointer events received since the last frame, in the order they occurred.  A move
+     * that is followed by another move of the same pointer is not delivered to the components; it
+     * only adds to the movement history used to calculate the fling velocity.  All other events are
+     * handled as if passed to handlePointerEvent() at their own timestamp.
+     *
+     * Call updateTime() first.  The timestamps should not be later than the current time.
+     *
+     * @param samples The pointer events with coordinates relative to the viewport, oldest first.
+     * @return true if any of the events was consumed and should not be passed through any platform handling.
+     */
+    virtual bool handlePointerEvents(const std::vector<PointerSample>& samples) = 0;
+
     /**
      * An update message from the viewhost called when a key is pressed.  The
      * keyboard message is directed to the focused component, or the document
@@ -16,6 +16,8 @@
 #ifndef _APL_EXTENSION_CLIENT_H
 #define _APL_EXTENSION_CLIENT_H
 
+#include <unordered_map>
+
 #include "apl/common.h"
 #include "apl/content/extensioncommanddefinition.h"
 #include "apl/content/extensioncomponentdefinition.h"
@@ -307,6 +309,8 @@ private:
     bool processLiveDataUpdate(const Context& context, const Object& update);
     bool processComponentResponse(const Context& context, const Object& response);
 
+    void compileSchema();
+
     bool updateLiveMap(ExtensionLiveDataUpdateType type, const LiveDataRef& dataRef, const Object& operation);
     bool updateLiveArray(ExtensionLiveDataUpdateType type, const LiveDataRef& dataRef, const Object& operation);
     void reportLiveMapChanges(const LiveDataRef& ref, const std::vector<LiveMapChange>& changes);
@@ -336,6 +340,11 @@ private:
     std::string mConnectionToken;
     std::map<std::string, LiveDataRef> mLiveData;
     std::map<id_type, ActionRef> mActionRefs;
+
+    // Dispatch tables compiled from the schema at registration, used by the per-message paths
+    std::unordered_map<std::string, bool> mFastModeEvents;
+    std::unordered_map<std::string, LiveDataRef*> mLiveDataIndex;
+    rapidjson::Document mCommandEnvelope;
     std::weak_ptr<CoreDocumentContext> mCachedContext;
     std::vector<ExtensionEvent> mPendingEvents;
 };
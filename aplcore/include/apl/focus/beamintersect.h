@@ -46,6 +46,16 @@ public:
      */
     Rect getCandidate() const { return mCandidate; }
 
+    /**
+     * @return Fraction of the beam cross-section covered by the candidate, 0 if it misses the beam.
+     */
+    float getIntersect() const { return mIntersect; }
+
+    /**
+     * @return Distance score between the origin and the candidate.
+     */
+    float getDistance() const { return mDistance; }
+
     /**
      * @return true if empty/invalid, false otherwise.
      */
@@ -16,6 +16,8 @@
 #ifndef _APL_FOCUS_FINDER_H
 #define _APL_FOCUS_FINDER_H
 
+#include <vector>
+
 #include "apl/common.h"
 #include "apl/focus/focusdirection.h"
 #include "apl/primitives/rect.h"
@@ -72,7 +74,34 @@ public:
      */
     static CoreComponentPtr getImplicitFocusRoot(const CoreComponentPtr& focused, FocusDirection direction);
 
+    /**
+     * Drop the cached focusable components.  Call this when components are added or removed, or
+     * change size, position or visibility.
+     */
+    void clearCache() { mCache.clear(); }
+
 private:
+    /**
+     * The focusable components of one search root along with their bounds relative to the root.
+     * The bounds do not depend on the scroll position of the root, so scrolling the root does not
+     * invalidate them.  The components are sorted lazily by the edge that each direction measures
+     * its distance from, so a search only looks at the components on the far side of the origin
+     * and stops once nothing further away can beat the best candidate.
+     */
+    struct FocusableSet {
+        struct Entry {
+            std::weak_ptr<CoreComponent> component;
+            Rect bounds;
+        };
+
+        std::weak_ptr<CoreComponent> root;
+        std::vector<Entry> entries;             // In tree order
+        std::vector<size_t> order[4];           // Sorted by left, right, top and bottom edge
+    };
+
+    FocusableSet& focusableSet(const CoreComponentPtr& root);
+    const std::vector<size_t>& sortedFor(FocusableSet& set, FocusDirection direction);
+
     CoreComponentPtr findNextInternal(const CoreComponentPtr& root, const Rect& focusedRect, FocusDirection direction);
     CoreComponentPtr findNextByTabOrder(const CoreComponentPtr& focused, const CoreComponentPtr& root, FocusDirection direction);
 
@@ -85,6 +114,8 @@ private:
             const CoreComponentPtr& candidateComponent,
             const Rect& candidateRect,
             FocusDirection direction);
+
+    std::vector<FocusableSet> mCache;   // Most recently used last
 };
 
 } // namespace apl
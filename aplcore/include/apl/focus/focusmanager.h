@@ -141,6 +141,12 @@ public:
      */
     CoreComponentPtr getFocus() { return mFocused.lock(); }
 
+    /**
+     * Forget the focusable components found by earlier searches.  Components call this when a child
+     * is added or removed, or changes size, position or visibility.
+     */
+    void invalidateFocusables();
+
     /**
      * Terminates the Focus sequencers and prevents any further operations.
      */
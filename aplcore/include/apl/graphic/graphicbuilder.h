@@ -52,6 +52,7 @@ private:
     void addChildren(GraphicElement& element, const Object& json);
     GraphicElementPtr createChild(const ContextPtr& context, const Object& json);
     GraphicElementPtr createChildFromArray(const ContextPtr& context, const std::vector<Object>& items);
+    bool needsContext(const std::vector<Object>& items) const;
 
 private:
     const GraphicPtr mGraphic;
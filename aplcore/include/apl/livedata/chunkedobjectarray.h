@@ -0,0 +1,114 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_CHUNKED_OBJECT_ARRAY_H
+#define _APL_CHUNKED_OBJECT_ARRAY_H
+
+#include <vector>
+
+#include "apl/primitives/object.h"
+
+namespace apl {
+
+/**
+ * An array of Objects stored as a sequence of blocks.  Inserting or removing an item moves at
+ * most one block of items plus the block start offsets, so edits at the front or middle of a large
+ * array cost O(B + n/B) instead of O(n).  Indexed access is a binary search over the blocks.
+ *
+ * A contiguous ObjectArray view is materialized lazily by getArray() and cached until the next
+ * modification.  Arrays that fit in a single block return that block directly without copying.
+ */
+class ChunkedObjectArray {
+public:
+    using size_type = ObjectArray::size_type;
+
+    /**
+     * Blocks are split when they grow past twice this size.
+     */
+    static const size_type BLOCK_SIZE = 256;
+
+    ChunkedObjectArray() = default;
+    explicit ChunkedObjectArray(ObjectArray&& array);
+
+    size_type size() const noexcept { return mSize; }
+    bool empty() const noexcept { return mSize == 0; }
+
+    /**
+     * @param position The index of the item.  Must be less than size().
+     * @return The item
+     */
+    const Object& at(size_type position) const;
+
+    /**
+     * Replace an item.
+     * @param position The index of the item.  Must be less than size().
+     * @param value The new value.
+     */
+    void set(size_type position, Object&& value);
+
+    /**
+     * Insert items before a position.
+     * @param position The index to insert at.  Must be less than or equal to size().
+     * @param values The items to insert.
+     */
+    void insert(size_type position, ObjectArray&& values);
+
+    /**
+     * Insert a single item before a position.
+     * @param position The index to insert at.  Must be less than or equal to size().
+     * @param value The item to insert.
+     */
+    void insert(size_type position, Object&& value);
+
+    /**
+     * Remove a range of items.
+     * @param position The index of the first item to remove.
+     * @param count The number of items to remove.  The range must lie within the array.
+     */
+    void erase(size_type position, size_type count);
+
+    void clear();
+
+    /**
+     * Call a function for each item, in order.
+     */
+    template<class F> void forEach(F&& func) const {
+        for (const auto& block : mBlocks)
+            for (const auto& item : block)
+                func(item);
+    }
+
+    /**
+     * @return A contiguous view of the items.  The reference is valid until the next modification.
+     */
+    const ObjectArray& getArray() const;
+
+private:
+    size_t findBlock(size_type position) const;
+    void splitBlock(size_t index);
+    void updateStarts(size_t fromBlock);
+    void invalidate() { mFlatValid = false; mFlat = ObjectArray(); }
+
+    std::vector<ObjectArray> mBlocks;
+    std::vector<size_type> mStarts;   // Index of the first item of each block
+    size_type mSize = 0;
+
+    mutable ObjectArray mFlat;
+    mutable bool mFlatValid = false;
+};
+
+} // namespace apl
+
+#endif // _APL_CHUNKED_OBJECT_ARRAY_H
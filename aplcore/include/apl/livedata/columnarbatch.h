@@ -0,0 +1,188 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_COLUMNAR_BATCH_H
+#define _APL_COLUMNAR_BATCH_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "apl/primitives/objectdata.h"
+#include "apl/primitives/objecttype.h"
+#include "apl/utils/noncopyable.h"
+
+namespace apl {
+
+/**
+ * A batch of items stored in a compact, column-oriented binary buffer.  Every item has the same
+ * set of typed fields.  The batch is meant for bulk loading a LiveArray or answering a data source
+ * fetch without building a JSON document and an ObjectMap per item:
+ *
+ *     auto batch = ColumnarBatch::create(std::move(bytes));
+ *     liveArray->push_back(batch->rows().begin(), batch->rows().end());
+ *
+ * Each row is exposed as a lightweight map Object that reads its fields straight out of the
+ * buffer when a binding asks for them.  Bindings see an ordinary map.
+ *
+ * Buffer layout (all integers and doubles are little-endian):
+ *
+ *     u32  magic "APLC"
+ *     u32  row count
+ *     u16  field count
+ *     per field:   u8 type, u16 name length, name bytes (UTF-8)
+ *     per field:   one column of row-count values
+ *                      kBoolean  u8
+ *                      kNumber   f64
+ *                      kString   u32 offset and u32 length into the string table
+ *     u32  string table length, followed by the string table bytes
+ *
+ * Use ColumnarBatchBuilder to write the format.
+ */
+class ColumnarBatch : public std::enable_shared_from_this<ColumnarBatch>,
+                      public NonCopyable {
+public:
+    enum FieldType : std::uint8_t {
+        kBoolean = 0,
+        kNumber = 1,
+        kString = 2
+    };
+
+    static const std::uint32_t MAGIC = 0x434c5041;  // "APLC"
+
+    /**
+     * Validate a buffer and wrap it as a batch.
+     * @param buffer The encoded batch.
+     * @return The batch, or nullptr if the buffer is malformed.
+     */
+    static std::shared_ptr<ColumnarBatch> create(std::vector<std::uint8_t>&& buffer);
+
+    /**
+     * Constructor. Do not call this directly; use the create() method.
+     */
+    explicit ColumnarBatch(std::vector<std::uint8_t>&& buffer) : mBuffer(std::move(buffer)) {}
+
+    size_t rowCount() const { return mRowCount; }
+    size_t fieldCount() const { return mFields.size(); }
+    const std::string& fieldName(size_t field) const { return mFields.at(field).name; }
+    FieldType fieldType(size_t field) const { return mFields.at(field).type; }
+
+    /**
+     * @param name The field name.
+     * @return The index of the field, or -1 if there is no field with that name.
+     */
+    int fieldIndex(const std::string& name) const;
+
+    /**
+     * @param row The row index.  Must be less than rowCount().
+     * @param field The field index.  Must be less than fieldCount().
+     * @return The value stored for the field in that row.
+     */
+    Object value(size_t row, size_t field) const;
+
+    /**
+     * @param row The row index.  Must be less than rowCount().
+     * @return A map Object that reads the fields of the row from this batch.
+     */
+    Object row(size_t row) const;
+
+    /**
+     * @return A map Object for every row, in order.  The array is built on first use.
+     */
+    const ObjectArray& rows() const;
+
+private:
+    struct Field {
+        std::string name;
+        FieldType type;
+        size_t offset;   // Start of the column in the buffer
+    };
+
+    bool parse();
+
+    std::vector<std::uint8_t> mBuffer;
+    std::vector<Field> mFields;
+    std::map<std::string, size_t> mFieldIndex;
+    size_t mRowCount = 0;
+    size_t mStringTable = 0;
+    size_t mStringTableLength = 0;
+    mutable ObjectArray mRows;
+};
+
+/**
+ * A read-only map view of a single row of a ColumnarBatch.  Fields are decoded on access; the
+ * full ObjectMap is only assembled if something asks for getMap().
+ */
+class ColumnarRowData : public ObjectData {
+public:
+    ColumnarRowData(const std::shared_ptr<const ColumnarBatch>& batch, size_t row)
+        : mBatch(batch), mRow(row) {}
+
+    Object get(const std::string& key) const override;
+    Object opt(const std::string& key, const Object& def) const override;
+    bool has(const std::string& key) const override { return mBatch->fieldIndex(key) >= 0; }
+    std::uint64_t size() const override { return mBatch->fieldCount(); }
+    bool empty() const override { return mBatch->fieldCount() == 0; }
+
+    const ObjectMap& getMap() const override;
+    void accept(Visitor<Object>& visitor) const override;
+    std::string toDebugString() const override;
+
+    bool operator==(const ObjectData& rhs) const override { return mapCompare(rhs); }
+
+    class ObjectType final : public MapObjectType<ColumnarRowData> {};
+
+private:
+    std::shared_ptr<const ColumnarBatch> mBatch;
+    size_t mRow;
+    mutable ObjectMap mMap;
+};
+
+/**
+ * Write a ColumnarBatch buffer.
+ *
+ *     ColumnarBatchBuilder builder({{"id", ColumnarBatch::kNumber}, {"title", ColumnarBatch::kString}});
+ *     builder.add({42, "Hello"});
+ *     auto batch = ColumnarBatch::create(builder.build());
+ */
+class ColumnarBatchBuilder {
+public:
+    using FieldList = std::vector<std::pair<std::string, ColumnarBatch::FieldType>>;
+
+    explicit ColumnarBatchBuilder(FieldList fields) : mFields(std::move(fields)) {}
+
+    /**
+     * Add a row.  Values are converted to the field type; missing values are written as false,
+     * zero or the empty string.
+     * @param values One value per field, in field order.
+     * @return This builder for chaining.
+     */
+    ColumnarBatchBuilder& add(const ObjectArray& values);
+
+    /**
+     * @return The encoded batch.
+     */
+    std::vector<std::uint8_t> build() const;
+
+private:
+    FieldList mFields;
+    std::vector<ObjectArray> mRows;
+};
+
+} // namespace apl
+
+#endif // _APL_COLUMNAR_BATCH_H
@@ -16,7 +16,9 @@
 #ifndef _APL_LIVE_ARRAY_H
 #define _APL_LIVE_ARRAY_H
 
+#include "apl/livedata/chunkedobjectarray.h"
 #include "apl/livedata/liveobject.h"
+#include "apl/livedata/liveproducer.h"
 #include "apl/utils/counter.h"
 
 namespace apl {
@@ -92,7 +94,10 @@ public:
      * create(ObjectArray&&) method.
      * @param array The array to start with.
      */
-    explicit LiveArray(ObjectArray&& array) : mArray(std::move(array)) {}
+    explicit LiveArray(ObjectArray&& array)
+        : mArray(std::move(array)),
+          mPending(std::make_shared<LiveArrayMutationQueue>())
+    {}
 
     // Override from LiveObject
     LiveObject::ObjectType getType() const override { return LiveObject::ObjectType::kArrayType; }
@@ -161,7 +166,7 @@ public:
         if (count == 0 || position > mArray.size())
             return false;
 
-        mArray.insert(mArray.begin() + position, first, last);
+        mArray.insert(position, ObjectArray(first, last));
         broadcastInsert(position, count);
         return true;
     }
@@ -206,7 +211,7 @@ public:
             return false;
 
         for (auto it = first ; it != last ; it++)
-            mArray.at(position + std::distance(first, it)) = *it;
+            mArray.set(position + std::distance(first, it), Object(*it));
 
         broadcastUpdate(position, count);
         return true;
@@ -238,17 +243,22 @@ public:
             return false;
 
         auto position = mArray.size();
-        for (auto it = first ; it != last ; it++)
-            mArray.push_back(*it);
-
+        mArray.insert(position, ObjectArray(first, last));
         broadcastInsert(position, std::distance(first, last));
         return true;
     }
 
     /**
-     * @return The internal array.  Generally you should not use this.
+     * The items are stored in blocks so that edits in the middle of large arrays are cheap.  This
+     * assembles a contiguous copy on demand, which is cached until the next change.
+     * @return The contents of the array as a vector.  Generally you should not use this.
      */
-    const std::vector<Object>& getArray() const { return mArray; }
+    const std::vector<Object>& getArray() const { return mArray.getArray(); }
+
+    /**
+     * Call a function for each item in the array, in order.  Unlike getArray() this never copies.
+     */
+    template<class F> void forEach(F&& func) const { mArray.forEach(std::forward<F>(func)); }
 
     /**
      * Add a change callback to this LiveArray.
@@ -269,13 +279,35 @@ public:
         mChangeCallbacks.erase(mChangeCallbacks.find(token));
     }
 
+    /**
+     * Create a handle that other threads can use to modify this array.  Mutations made through
+     * the handle are queued and applied on the engine thread when live data is next flushed.
+     * @return The producer handle.
+     */
+    LiveArrayProducer producer() const { return LiveArrayProducer(mPending); }
+
+    /**
+     * Apply the mutations queued by producer handles.  Adjacent inserts and pushes are merged
+     * into a single range change, repeated updates of one item keep only the last value, and a
+     * clear discards everything queued before it.  This is called by the LiveDataManager; only
+     * call it from the engine thread.
+     * @return True if the array changed.
+     */
+    bool applyPendingMutations();
+
+    /**
+     * @return Counters for the mutations queued by producer handles.
+     */
+    LiveProducerStats producerStats() const { return mPending->stats(); }
+
 private:
     void broadcast( const LiveArrayChange& command );
     void broadcastInsert( size_type position, size_type count );
     void broadcastUpdate( size_type position, size_type count );
 
 private:
-    ObjectArray mArray;
+    ChunkedObjectArray mArray;
+    std::shared_ptr<LiveArrayMutationQueue> mPending;
     int mChangeCallbackToken = 100;
     std::map<int, ChangeCallback> mChangeCallbacks;
 };
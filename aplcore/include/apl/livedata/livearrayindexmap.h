@@ -0,0 +1,74 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_LIVE_ARRAY_INDEX_MAP_H
+#define _APL_LIVE_ARRAY_INDEX_MAP_H
+
+#include <vector>
+
+#include "apl/livedata/livearraychange.h"
+
+namespace apl {
+
+/**
+ * A run-length encoded mapping from the indices of a LiveArray after a set of changes to the
+ * indices of the same array before the changes were applied.
+ *
+ * The new array is described as a sequence of runs.  Each run is either a block of new items
+ * (which have no old index) or a block of items that existed in the old array at consecutive
+ * indices.  A run also records if the items in it were updated.
+ *
+ * The map is compiled once from the change log, which costs O(k^2) in the number of changes
+ * and is independent of the size of the array.  Walking the runs in order visits every new
+ * index in O(n + k).
+ */
+class LiveArrayIndexMap {
+public:
+    using size_type = LiveArrayChange::size_type;
+
+    struct Run {
+        size_type count;   // Number of items in this run
+        int oldIndex;      // Old index of the first item or -1 if the items were inserted
+        bool changed;      // True if the items in this run have been updated
+    };
+
+    /**
+     * Compile the change log of an array.
+     * @param changes The changes applied to the array, in order
+     * @param newSize The size of the array after the changes were applied.
+     */
+    LiveArrayIndexMap(const std::vector<LiveArrayChange>& changes, size_type newSize);
+
+    /**
+     * @return The runs covering the new array, in order
+     */
+    const std::vector<Run>& runs() const { return mRuns; }
+
+    /**
+     * Look up a single new index.  Prefer walking runs() when visiting every index.
+     * @param index The index in the new array
+     * @return A pair containing the old index (-1 if the item is new) and a flag that is true if
+     *         the item has changed value.
+     */
+    std::pair<int, bool> newToOld(size_type index) const;
+
+private:
+    std::vector<Run> mRuns;
+    std::vector<size_type> mStarts;  // New index of the first item in each run
+};
+
+} // namespace apl
+
+#endif // _APL_LIVE_ARRAY_INDEX_MAP_H
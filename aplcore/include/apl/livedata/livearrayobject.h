@@ -20,6 +20,7 @@
 #include "apl/utils/counter.h"
 #include "apl/livedata/livedataobject.h"
 #include "apl/livedata/livearraychange.h"
+#include "apl/livedata/livearrayindexmap.h"
 
 namespace apl {
 
@@ -74,6 +75,8 @@ public:
 
     virtual void ensure(size_t index) {}
 
+    void applyPendingMutations() override;
+
     /**
      * This is called from the LiveDataManager to flush all stored array changes and update the context
      */
@@ -92,6 +95,13 @@ public:
      */
     std::pair<int, bool> newToOld(ObjectArray::size_type index);
 
+    /**
+     * The stored changes compiled into runs of new and old items.  The map is built on first use
+     * and kept until the next change or flush.
+     * @return The index map from the current array to the array before the stored changes occurred.
+     */
+    const LiveArrayIndexMap& indexMap();
+
     /**
      * @return true if internal implementation may request items added or removed based on current binding state, false
      * otherwise.
@@ -109,6 +119,7 @@ private:
 private:
     LiveArrayPtr mLiveArray;
     std::vector<LiveArrayChange> mChanges;
+    std::unique_ptr<LiveArrayIndexMap> mIndexMap;
 };
 
 } // namespace apl
@@ -88,6 +88,12 @@ public:
         mMaxWatcherTokenBeforeFlush = mWatcherToken;
     }
 
+    /**
+     * Apply mutations queued from other threads to the underlying live object.  Called by the
+     * LiveDataManager before any objects are flushed.
+     */
+    virtual void applyPendingMutations() {}
+
     /**
      * Flush tracking changes
      */
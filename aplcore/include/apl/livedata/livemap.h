@@ -17,6 +17,7 @@
 #define _APL_LIVE_MAP_H
 
 #include "apl/livedata/liveobject.h"
+#include "apl/livedata/liveproducer.h"
 #include "apl/utils/counter.h"
 
 namespace apl {
@@ -77,7 +78,10 @@ public:
      * Default constructor. Do not call this; use the create() method.
      * @param map The initial object map
      */
-    explicit LiveMap(ObjectMap&& map) : mMap(std::move(map)) {}
+    explicit LiveMap(ObjectMap&& map)
+        : mMap(std::move(map)),
+          mPending(std::make_shared<LiveMapMutationQueue>())
+    {}
 
     // Override from LiveObject
     LiveObject::ObjectType getType() const override { return LiveObject::ObjectType::kMapType; }
@@ -119,14 +123,25 @@ public:
     }
 
     /**
-     * Set a key-value pair in the map.
+     * Set a key-value pair in the map.  Setting a key to the value it already holds is not a change.
      * @param key The key to insert
      * @param value The value to store
      */
     template<class T>
     void set(const std::string& key, T&& value) {
-        mMap[key] = std::forward<T>(value);
-        broadcastSet(key);
+        auto it = mMap.find(key);
+        if (it == mMap.end()) {
+            mMap.emplace(key, std::forward<T>(value));
+            broadcastSet(key);
+            return;
+        }
+
+        Object incoming(std::forward<T>(value));
+        if (incoming == it->second)
+            return;
+
+        std::swap(it->second, incoming);
+        broadcastSet(key, incoming);
     }
 
     /**
@@ -175,12 +190,34 @@ public:
         mChangeCallbacks.erase(mChangeCallbacks.find(token));
     }
 
+    /**
+     * Create a handle that other threads can use to modify this map.  Mutations made through
+     * the handle are queued and applied on the engine thread when live data is next flushed.
+     * @return The producer handle.
+     */
+    LiveMapProducer producer() const { return LiveMapProducer(mPending); }
+
+    /**
+     * Apply the mutations queued by producer handles.  Only the last set or remove of each key
+     * is applied, and a clear or replace discards everything queued before it.  This is called
+     * by the LiveDataManager; only call it from the engine thread.
+     * @return True if the map changed.
+     */
+    bool applyPendingMutations();
+
+    /**
+     * @return Counters for the mutations queued by producer handles.
+     */
+    LiveProducerStats producerStats() const { return mPending->stats(); }
+
 private:
     void broadcast(const LiveMapChange& command);
     void broadcastSet(const std::string& key);
+    void broadcastSet(const std::string& key, const Object& previous);
 
 private:
     ObjectMap mMap;
+    std::shared_ptr<LiveMapMutationQueue> mPending;
     int mChangeCallbackToken = 100;
     std::map<int, ChangeCallback> mChangeCallbacks;
 };
@@ -16,6 +16,10 @@
 #ifndef _APL_LIVE_MAP_CHANGE_H
 #define _APL_LIVE_MAP_CHANGE_H
 
+#include <string>
+
+#include "apl/primitives/object.h"
+
 namespace apl {
 
 /**
@@ -29,20 +33,48 @@ public:
         REPLACE
     };
 
-    static LiveMapChange set(const std::string& key) { return {SET, key}; }
-    static LiveMapChange remove(const std::string& key) { return {REMOVE, key}; }
-    static LiveMapChange replace() { return {REPLACE, ""}; }
+    static LiveMapChange set(const std::string& key) { return {SET, key, Object::NULL_OBJECT(), false}; }
+    static LiveMapChange remove(const std::string& key) { return {REMOVE, key, Object::NULL_OBJECT(), false}; }
+    static LiveMapChange replace() { return {REPLACE, "", Object::NULL_OBJECT(), false}; }
+
+    /**
+     * A change to a key that held a value before the change.
+     */
+    static LiveMapChange set(const std::string& key, const Object& previous) { return {SET, key, previous, true}; }
+    static LiveMapChange remove(const std::string& key, const Object& previous) { return {REMOVE, key, previous, true}; }
 
     Command command() const { return mCommand; }
     std::string key() const { return mKey; }
 
+    /**
+     * @return True if the key existed before this change.  Only meaningful for SET and REMOVE.
+     */
+    bool hadPrevious() const { return mHadPrevious; }
+
+    /**
+     * @return The value of the key before this change.
+     */
+    const Object& previous() const { return mPrevious; }
+
+    /**
+     * Combine this change with a later change to the same key.  The result has the command of the
+     * later change and the previous value of this one.
+     * @param later The later change.
+     * @return The combined change.
+     */
+    LiveMapChange then(const LiveMapChange& later) const {
+        return {later.mCommand, mKey, mPrevious, mHadPrevious};
+    }
+
 private:
-    LiveMapChange(Command command, const std::string& key)
-        : mCommand(command), mKey(key) {}
+    LiveMapChange(Command command, const std::string& key, const Object& previous, bool hadPrevious)
+        : mCommand(command), mKey(key), mPrevious(previous), mHadPrevious(hadPrevious) {}
 
 private:
     Command mCommand;
     std::string mKey;
+    Object mPrevious;
+    bool mHadPrevious;
 };
 
 
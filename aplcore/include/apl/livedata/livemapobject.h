@@ -69,13 +69,16 @@ public:
 
     std::string toDebugString() const override { return "LiveMapObject<size=" + std::to_string(size()) + ">"; }
 
+    void applyPendingMutations() override;
+
     /**
      * This is called from the LiveDataManager to flush all stored map changes and update the context
      */
     void flush() override;
 
     /**
-     * @return list of changes processed for this map.
+     * @return list of changes processed for this map.  Changes are coalesced so that each key
+     *         appears at most once, and keys that are back at their original value are omitted.
      */
     const std::vector<LiveMapChange>& getChanges();
 
@@ -91,10 +94,12 @@ public:
 
 private:
     void handleMapMessage(const LiveMapChange& change);
+    void dropUnchanged();
 
 private:
     LiveMapPtr mLiveMap;
     std::vector<LiveMapChange> mChanges;
+    std::map<std::string, size_t> mChangeIndex;  // Offset of each key's change in mChanges
     std::set<std::string> mChanged;
 };
 
@@ -0,0 +1,190 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_LIVE_PRODUCER_H
+#define _APL_LIVE_PRODUCER_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "apl/primitives/object.h"
+#include "apl/utils/mpscqueue.h"
+
+namespace apl {
+
+/**
+ * Counters for the mutations queued through LiveArrayProducer or LiveMapProducer handles.
+ * Every queued mutation ends up counted exactly once as applied, coalesced or rejected.
+ */
+struct LiveProducerStats {
+    size_t enqueued = 0;   // Mutations pushed by producers
+    size_t applied = 0;    // Mutations that changed the live object
+    size_t coalesced = 0;  // Mutations merged into a neighbour or superseded by a later mutation
+    size_t rejected = 0;   // Mutations with an out-of-range position or a missing key
+    size_t drains = 0;     // Number of flushes that found queued mutations
+};
+
+/**
+ * A mutation queued by a LiveArrayProducer.
+ */
+struct LiveArrayMutation {
+    enum Command { INSERT, PUSH_BACK, REMOVE, UPDATE, CLEAR };
+
+    Command command;
+    size_t position;
+    size_t count;
+    Object value;
+};
+
+/**
+ * A mutation queued by a LiveMapProducer.
+ */
+struct LiveMapMutation {
+    enum Command { SET, REMOVE, REPLACE, CLEAR };
+
+    Command command;
+    std::string key;
+    Object value;
+    ObjectMap map;
+};
+
+/**
+ * The queue shared between a live object and its producer handles.  Producers push from any
+ * thread; the live object drains the queue on the engine thread and records what happened.
+ */
+template<class Mutation>
+class LiveMutationQueue {
+public:
+    void push(Mutation&& mutation) {
+        mQueue.push(std::move(mutation));
+        mEnqueued.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool empty() const { return mQueue.empty(); }
+
+    std::vector<Mutation> drain() {
+        auto result = mQueue.drain();
+        if (!result.empty())
+            mDrains.fetch_add(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    void record(size_t applied, size_t coalesced, size_t rejected) {
+        mApplied.fetch_add(applied, std::memory_order_relaxed);
+        mCoalesced.fetch_add(coalesced, std::memory_order_relaxed);
+        mRejected.fetch_add(rejected, std::memory_order_relaxed);
+    }
+
+    LiveProducerStats stats() const {
+        LiveProducerStats result;
+        result.enqueued = mEnqueued.load(std::memory_order_relaxed);
+        result.applied = mApplied.load(std::memory_order_relaxed);
+        result.coalesced = mCoalesced.load(std::memory_order_relaxed);
+        result.rejected = mRejected.load(std::memory_order_relaxed);
+        result.drains = mDrains.load(std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    MPSCQueue<Mutation> mQueue;
+    std::atomic<size_t> mEnqueued{0};
+    std::atomic<size_t> mApplied{0};
+    std::atomic<size_t> mCoalesced{0};
+    std::atomic<size_t> mRejected{0};
+    std::atomic<size_t> mDrains{0};
+};
+
+using LiveArrayMutationQueue = LiveMutationQueue<LiveArrayMutation>;
+using LiveMapMutationQueue = LiveMutationQueue<LiveMapMutation>;
+
+/**
+ * A handle for modifying a LiveArray from any thread.  Obtain one from LiveArray::producer().
+ *
+ * Mutations are queued without locking and applied to the LiveArray on the engine thread the
+ * next time the data is flushed (for example, by RootContext::clearPending()).  Positions are
+ * checked when the mutation is applied, so they refer to the array as modified by all earlier
+ * mutations in the queue.  Handles may be copied freely and may outlive the LiveArray.
+ */
+class LiveArrayProducer {
+public:
+    using size_type = size_t;
+
+    void insert(size_type position, Object value) {
+        mQueue->push({LiveArrayMutation::INSERT, position, 1, std::move(value)});
+    }
+
+    void push_back(Object value) {
+        mQueue->push({LiveArrayMutation::PUSH_BACK, 0, 1, std::move(value)});
+    }
+
+    void remove(size_type position, size_type count = 1) {
+        mQueue->push({LiveArrayMutation::REMOVE, position, count, Object::NULL_OBJECT()});
+    }
+
+    void update(size_type position, Object value) {
+        mQueue->push({LiveArrayMutation::UPDATE, position, 1, std::move(value)});
+    }
+
+    void clear() {
+        mQueue->push({LiveArrayMutation::CLEAR, 0, 0, Object::NULL_OBJECT()});
+    }
+
+private:
+    friend class LiveArray;
+
+    explicit LiveArrayProducer(const std::shared_ptr<LiveArrayMutationQueue>& queue) : mQueue(queue) {}
+
+    std::shared_ptr<LiveArrayMutationQueue> mQueue;
+};
+
+/**
+ * A handle for modifying a LiveMap from any thread.  Obtain one from LiveMap::producer().
+ * Mutations are queued without locking and applied on the engine thread at the next data flush.
+ */
+class LiveMapProducer {
+public:
+    void set(const std::string& key, Object value) {
+        mQueue->push({LiveMapMutation::SET, key, std::move(value), ObjectMap{}});
+    }
+
+    void update(const ObjectMap& map) {
+        for (const auto& m : map)
+            set(m.first, m.second);
+    }
+
+    void remove(const std::string& key) {
+        mQueue->push({LiveMapMutation::REMOVE, key, Object::NULL_OBJECT(), ObjectMap{}});
+    }
+
+    void replace(ObjectMap&& map) {
+        mQueue->push({LiveMapMutation::REPLACE, std::string(), Object::NULL_OBJECT(), std::move(map)});
+    }
+
+    void clear() {
+        mQueue->push({LiveMapMutation::CLEAR, std::string(), Object::NULL_OBJECT(), ObjectMap{}});
+    }
+
+private:
+    friend class LiveMap;
+
+    explicit LiveMapProducer(const std::shared_ptr<LiveMapMutationQueue>& queue) : mQueue(queue) {}
+
+    std::shared_ptr<LiveMapMutationQueue> mQueue;
+};
+
+} // namespace apl
+
+#endif // _APL_LIVE_PRODUCER_H
@@ -288,6 +288,8 @@ public:
     };
 
 private:
+    friend class DirtyPropertyEncoder;
+
     StyledText() = default;
     explicit StyledText(const std::string& raw);
     StyledText(const Context& context, const std::string& raw);
@@ -59,6 +59,12 @@ public:
         return result;
     }
 
+    /**
+     * @return A counter that increases every time the path is modified.  Unlike modified(), reading
+     *         this does not clear anything, so any number of caches can use it to detect changes.
+     */
+    unsigned int generation() const { return mGeneration; }
+
     /**
      * @return True if this path has no segments.  Rectangular paths ALWAYS have segments,
      *         even if the length of those segments are zero.
@@ -97,8 +103,14 @@ public:
 protected:
     explicit Path(Type type) : mType(type) {}
 
+    void setModified() {
+        mModified = true;
+        mGeneration++;
+    }
+
     const Type mType;
     bool mModified = false;
+    unsigned int mGeneration = 0;
 };
 
 
@@ -0,0 +1,150 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_SG_TESSELLATION_H
+#define _APL_SG_TESSELLATION_H
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "apl/primitives/point.h"
+#include "apl/primitives/transform2d.h"
+#include "apl/scenegraph/common.h"
+
+namespace apl {
+namespace sg {
+
+class StrokePathOp;
+
+/**
+ * A flattened sub-path: a sequence of straight line segments.
+ */
+struct Contour {
+    std::vector<Point> points;
+    bool closed = false;
+};
+
+using Contours = std::vector<Contour>;
+using ContoursPtr = std::shared_ptr<const Contours>;
+
+/**
+ * Flatten a path into straight line segments.  Curves and rounded corners are subdivided until
+ * the maximum deviation from the true curve is less than the tolerance, measured after the
+ * transform is applied.  The returned points are in the local coordinate space of the path; the
+ * transform is only used to pick the subdivision level.
+ *
+ * Frame paths produce two contours (the outer and the inset rounded rectangle) that should be
+ * filled with the even-odd rule.
+ *
+ * @param path The path to flatten
+ * @param transform The transform that will be used to draw the path
+ * @param tolerance The maximum deviation in device units
+ * @return The flattened contours
+ */
+Contours flattenPath(const Path& path, const Transform2D& transform, float tolerance);
+
+/**
+ * Convert flattened contours into the outline of a stroke, applying the dash pattern, line caps,
+ * line joins, and miter limit of the stroke operation.  The result is a set of closed polygons
+ * with a consistent orientation which should be filled with the non-zero winding rule.
+ *
+ * @param contours The flattened contours (normally from flattenPath)
+ * @param stroke The stroke operation
+ * @param transform The transform that will be used to draw the path
+ * @param tolerance The maximum deviation in device units (used for round caps and joins)
+ * @return The stroke outline
+ */
+Contours strokeContours(const Contours& contours, const StrokePathOp& stroke,
+                        const Transform2D& transform, float tolerance);
+
+/**
+ * A cache of tessellated path and stroke geometry for hosts that rasterize the scene graph on the CPU.
+ *
+ * Entries are keyed by path identity, the scaling of the drawing transform (translations and
+ * small changes in scale reuse the same entry), the tolerance, and for strokes the stroke
+ * parameters.  An entry is discarded when its path is modified (see Path::generation) or
+ * released.  The cache holds at most a fixed number of entries and evicts the least recently used.
+ */
+class TessellationCache {
+public:
+    explicit TessellationCache(size_t maxEntries = 512) : mMaxEntries(maxEntries) {}
+
+    /**
+     * Retrieve the flattened contours of a path
+     * @param path The path
+     * @param transform The transform that will be used to draw the path
+     * @param tolerance The maximum deviation in device units
+     * @return The flattened contours in the local coordinate space of the path.
+     */
+    ContoursPtr fill(const PathPtr& path, const Transform2D& transform, float tolerance = 0.25f);
+
+    /**
+     * Retrieve the stroke outline of a path
+     * @param path The path
+     * @param stroke The stroke operation
+     * @param transform The transform that will be used to draw the path
+     * @param tolerance The maximum deviation in device units
+     * @return The stroke outline polygons in the local coordinate space of the path.
+     */
+    ContoursPtr stroke(const PathPtr& path, const StrokePathOp& stroke, const Transform2D& transform,
+                       float tolerance = 0.25f);
+
+    /**
+     * Remove all entries for released paths.
+     */
+    void clean();
+
+    /**
+     * Remove all entries.
+     */
+    void clear();
+
+    size_t size() const { return mEntries.size(); }
+    size_t hits() const { return mHits; }
+    size_t misses() const { return mMisses; }
+
+private:
+    struct Key {
+        const Path *path;
+        int scaleBucket;
+        float tolerance;
+        std::vector<float> stroke;  // Empty for fills
+
+        bool operator<(const Key& rhs) const;
+    };
+
+    struct Entry {
+        std::weak_ptr<Path> path;
+        unsigned int generation;
+        ContoursPtr contours;
+        std::list<Key>::iterator lru;
+    };
+
+    ContoursPtr lookup(const PathPtr& path, Key&& key, const std::function<Contours()>& build);
+
+    size_t mMaxEntries;
+    std::map<Key, Entry> mEntries;
+    std::list<Key> mLRU;  // Most recently used at the front
+    size_t mHits = 0;
+    size_t mMisses = 0;
+};
+
+} // namespace sg
+} // namespace apl
+
+#endif // _APL_SG_TESSELLATION_H
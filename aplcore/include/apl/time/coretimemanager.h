@@ -20,18 +20,27 @@
 #include <vector>
 #include <limits>
 #include <atomic>
+#include <deque>
 #include <map>
+#include <memory>
 
 #include "apl/time/timemanager.h"
+#include "apl/time/timerqueue.h"
 
 namespace apl {
 
 /**
- * A heap-based implementation of a TimeManager.
+ * The standard implementation of a TimeManager.  Pending timeouts are kept in a TimerQueue, which
+ * is a binary heap unless another queue is supplied.
+ *
+ * Running animators are kept in a registry of slots.  The queue only holds the timeout that ends
+ * each animator, so the per-frame animator tick walks the registry and does not copy or allocate.
  */
 class CoreTimeManager : public TimeManager {
 public:
-    explicit CoreTimeManager(apl_time_t time) : mTime(time), mNextId(100), mAnimatorCount(0), mTerminated(false){}
+    explicit CoreTimeManager(apl_time_t time, std::unique_ptr<TimerQueue> timers = nullptr)
+        : mTimers(timers ? std::move(timers) : std::unique_ptr<TimerQueue>(new HeapTimerQueue())),
+          mTime(time), mNextId(100), mAnimatorCount(0), mTerminated(false) {}
     ~CoreTimeManager() override = default;
 
     /****** Methods from Timers *******/
@@ -44,7 +53,7 @@ public:
 
     /****** Methods from TimeManager *******/
 
-    int size() const override { return static_cast<int>(mTimerHeap.size()); }
+    int size() const override { return static_cast<int>(mTimers->size()); }
     void updateTime(apl_time_t updatedTime) override;
     apl_time_t nextTimeout() override;
     apl_time_t currentTime() const override { return mTime; }
@@ -55,30 +64,38 @@ public:
 
 protected:
     void advanceToNext();
+    size_t acquireSlot(Animator&& animator, timeout_id id, apl_time_t startTime);
+    void releaseSlot(size_t slot);
 
 protected:
-    // Hold regular timers until they fire
-    struct TimeoutTuple {
-        TimeoutTuple(Runnable runnable, Animator animator, apl_time_t startTime, apl_duration_t duration, timeout_id id)
-            : runnable(runnable), animator(animator), startTime(startTime), endTime(startTime + duration), id(id) {}
+    // Hold regular timers until they fire.  An animator is held until its final call.
+    std::unique_ptr<TimerQueue> mTimers;
+    apl_time_t mTime;
+    timeout_id mNextId;
+    int mAnimatorCount;
+    std::atomic<bool> mTerminated;
+    std::map<timeout_id, TimerQueueEntry> mFrozen;
 
-        Runnable runnable;
+    // Registry of animators.  The owning timeout id doubles as the generation of a slot, so a tick
+    // never calls an animator that was cleared and replaced while the tick was running.  Slots live
+    // in a deque so that an animator can register another animator while it is being called.
+    struct AnimatorSlot {
         Animator animator;
-        apl_time_t startTime;
-        apl_time_t endTime;
-        timeout_id id;
+        apl_time_t startTime = 0;
+        timeout_id id = 0;      // Zero when the slot is free
+        bool active = false;    // False when frozen or cleared
+    };
 
-        bool operator<(const TimeoutTuple& rhs) const {
-            return endTime > rhs.endTime;  // Reverse the order deliberately
-        }
+    struct TickEntry {
+        size_t slot;
+        timeout_id id;
     };
 
-    std::vector<TimeoutTuple> mTimerHeap;
-    apl_time_t mTime;
-    timeout_id mNextId;
-    int mAnimatorCount;
-    std::atomic<bool> mTerminated;
-    std::map<timeout_id, TimeoutTuple> mFrozen;
+    std::deque<AnimatorSlot> mAnimators;
+    std::vector<size_t> mFreeSlots;
+    std::vector<TickEntry> mTickEntries;    // Reused by each tick
+    std::vector<size_t> mReleasedSlots;     // Slots cleared during a tick
+    bool mTicking = false;
 };
 
 
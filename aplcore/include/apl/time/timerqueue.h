@@ -0,0 +1,110 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_TIMER_QUEUE_H
+#define _APL_TIMER_QUEUE_H
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "apl/time/timers.h"
+
+namespace apl {
+
+/**
+ * A pending timeout.  Animators are represented by the timeout that ends them.
+ */
+struct TimerQueueEntry {
+    static const size_t NO_SLOT = std::numeric_limits<size_t>::max();
+
+    TimerQueueEntry() = default;
+    TimerQueueEntry(Timers::Runnable runnable, size_t slot, apl_time_t startTime, apl_duration_t duration, timeout_id id)
+        : runnable(std::move(runnable)), slot(slot), startTime(startTime), endTime(startTime + duration), id(id) {}
+
+    Timers::Runnable runnable;
+    size_t slot = NO_SLOT;  // Animator slot or NO_SLOT for a regular timer
+    apl_time_t startTime = 0;
+    apl_time_t endTime = 0;
+    timeout_id id = 0;
+};
+
+/**
+ * Storage for the pending timeouts of a CoreTimeManager.  Timeouts leave the queue in order of
+ * their end time.
+ */
+class TimerQueue {
+public:
+    virtual ~TimerQueue() = default;
+
+    /**
+     * Add a timeout.
+     */
+    virtual void push(TimerQueueEntry&& entry) = 0;
+
+    /**
+     * Remove a timeout.
+     * @param id The timeout id.
+     * @param removed If not null, the removed timeout is moved here.
+     * @return True if the timeout was found.
+     */
+    virtual bool remove(timeout_id id, TimerQueueEntry *removed) = 0;
+
+    /**
+     * @return The end time of the earliest timeout, or the largest time value if there is none.
+     */
+    virtual apl_time_t nextTime() = 0;
+
+    /**
+     * Remove and return the earliest timeout.  The queue must not be empty.
+     */
+    virtual TimerQueueEntry pop() = 0;
+
+    /**
+     * @return Number of timeouts in the queue.
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * Call a function for every timeout in the queue, in no particular order.
+     */
+    virtual void forEach(const std::function<void(const TimerQueueEntry&)>& func) const = 0;
+
+    /**
+     * Remove all timeouts.
+     */
+    virtual void clear() = 0;
+};
+
+/**
+ * A binary heap of timeouts.  Removing a timeout searches the heap.
+ */
+class HeapTimerQueue : public TimerQueue {
+public:
+    void push(TimerQueueEntry&& entry) override;
+    bool remove(timeout_id id, TimerQueueEntry *removed) override;
+    apl_time_t nextTime() override;
+    TimerQueueEntry pop() override;
+    size_t size() const override { return mHeap.size(); }
+    void forEach(const std::function<void(const TimerQueueEntry&)>& func) const override;
+    void clear() override { mHeap.clear(); }
+
+private:
+    std::vector<TimerQueueEntry> mHeap;
+};
+
+} // namespace apl
+
+#endif // _APL_TIMER_QUEUE_H
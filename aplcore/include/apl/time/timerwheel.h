@@ -0,0 +1,85 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_TIMER_WHEEL_H
+#define _APL_TIMER_WHEEL_H
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "apl/time/timerqueue.h"
+
+namespace apl {
+
+/**
+ * A hierarchical timer wheel.  Adding and removing a timeout take constant time.
+ *
+ * Each level of the wheel has 64 buckets.  A bucket in the first level holds the timeouts that
+ * end within one millisecond; a bucket in each following level spans the whole previous level.
+ * A timeout is placed in the lowest level whose span contains both the current position of the
+ * wheel and the end of the timeout.  When the wheel reaches a bucket in a higher level, the bucket
+ * is spread over the lower levels.  Timeouts beyond the top level are kept in an overflow list.
+ *
+ * Timeouts leave in order of their end time.  Timeouts with the same end time leave in the order
+ * they were added.
+ */
+class TimerWheel : public TimerQueue {
+public:
+    TimerWheel();
+
+    void push(TimerQueueEntry&& entry) override;
+    bool remove(timeout_id id, TimerQueueEntry *removed) override;
+    apl_time_t nextTime() override;
+    TimerQueueEntry pop() override;
+    size_t size() const override { return mIndex.size(); }
+    void forEach(const std::function<void(const TimerQueueEntry&)>& func) const override;
+    void clear() override;
+
+private:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const size_t OVERFLOW_BUCKET = LEVELS * SLOTS;
+    static const size_t NONE = std::numeric_limits<size_t>::max();
+
+    struct Node {
+        TimerQueueEntry entry;
+        std::uint64_t sequence = 0;
+        size_t bucket = NONE;
+        size_t prev = NONE;
+        size_t next = NONE;
+    };
+
+    std::int64_t tickOf(const Node& node) const;
+    void place(size_t node);
+    void link(size_t node, size_t bucket);
+    void unlink(size_t node);
+    void spread(size_t bucket);
+    size_t earliestBucket();
+    size_t earliestIn(size_t bucket) const;
+    void take(size_t node, TimerQueueEntry *removed);
+
+    std::vector<Node> mNodes;
+    std::vector<size_t> mFreeNodes;
+    std::vector<size_t> mHeads;                     // First node of each bucket
+    std::uint64_t mOccupied[LEVELS];                // One bit per non-empty bucket
+    std::unordered_map<timeout_id, size_t> mIndex;  // Timeout id to node
+    std::int64_t mCurrent = 0;                      // Position of the wheel in milliseconds
+    std::uint64_t mSequence = 0;
+};
+
+} // namespace apl
+
+#endif // _APL_TIMER_WHEEL_H
@@ -65,6 +65,14 @@ public:
      */
     virtual bool consume(const PointerEvent& event, apl_time_t timestamp);
 
+    /**
+     * Record a pointer move that was coalesced into a later move.  Unlike consume(), this never
+     * changes the state of the gesture.
+     * @param event Pointer move event.
+     * @param timestamp Event timestamp.
+     */
+    void track(const PointerEvent& event, apl_time_t timestamp);
+
     /**
      * Reset internal gesture state.
      */
@@ -103,6 +111,14 @@ protected:
      */
     virtual bool onMove(const PointerEvent& event, apl_time_t timestamp) { return true; }
 
+    /**
+     * Handle a move that was coalesced into a later move.  Only gestures that depend on the path of
+     * the pointer, and not just its latest position, need to override this.
+     * @param event pointer event to process.
+     * @param timestamp pointer event timestamp.
+     */
+    virtual void onTrack(const PointerEvent& event, apl_time_t timestamp) {}
+
     /**
      * Handle time update
      * @param event pointer event to process (simulated in this case, so should be generally ignored)
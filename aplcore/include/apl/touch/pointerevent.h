@@ -125,6 +125,32 @@ struct PointerEvent
     const PointerType pointerType;
 };
 
+/**
+ * A pointer event together with the time at which the viewhost sampled it.  Viewhosts with input
+ * devices that report faster than the display refresh use these to deliver the events received
+ * since the last frame in a single call.
+ */
+struct PointerSample
+{
+    /**
+     * @param event The pointer event.
+     * @param timestamp The time the event was sampled, on the same clock as RootContext::updateTime.
+     */
+    PointerSample(const PointerEvent& event, apl_time_t timestamp)
+        : event(event),
+          timestamp(timestamp) {};
+
+    /**
+     * The pointer event
+     */
+    const PointerEvent event;
+
+    /**
+     * The time at which the event was sampled
+     */
+    const apl_time_t timestamp;
+};
+
 extern Bimap<PointerEventType, PropertyKey> sEventHandlers;
 
 } // namespace apl
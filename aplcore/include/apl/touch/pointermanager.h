@@ -18,6 +18,7 @@
 
 
 #include <map>
+#include <vector>
 
 #include "apl/touch/pointer.h"
 
@@ -78,6 +79,16 @@ public:
      */
     bool handlePointerEvent(const PointerEvent& pointerEvent, apl_time_t timestamp);
 
+    /**
+     * Handles a batch of timestamped PointerEvents.  Consecutive moves of the same pointer are coalesced: the earlier
+     * ones are only recorded in the movement history of the gestures of the target, and the last one is handled as
+     * a regular move.  Every other event is passed to handlePointerEvent.
+     *
+     * @param samples The pointer events, oldest first.
+     * @return true if any event was consumed and should not be passed through any platform handling.
+     */
+    bool handlePointerEvents(const std::vector<PointerSample>& samples);
+
     /**
      * Function to notify all interested parties about pointer related time updates.
      * @param timestamp The time of the event
@@ -93,6 +104,14 @@ private:
      */
     std::shared_ptr<Pointer> getOrCreatePointer(const PointerEvent &pointerEvent);
 
+    /**
+     * Records a move of the active pointer that was coalesced into a later move.  The move is routed the same way as a
+     * regular event but only updates the movement history of the gestures; it does not run any event handlers.
+     * @param pointerEvent The coalesced move.
+     * @param timestamp The time of the move.
+     */
+    void handlePointerHistory(const PointerEvent& pointerEvent, apl_time_t timestamp);
+
     /* The internal handle methods are responsible for validation, state maintenance and event forwarding i.e. hover */
 
     /**
@@ -0,0 +1,108 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_JSON_SINK_H
+#define _APL_JSON_SINK_H
+
+#include <cstdint>
+#include <string>
+
+#include "rapidjson/document.h"
+
+namespace apl {
+
+/**
+ * Abstract destination for streaming JSON serialization.  The method set matches the RapidJSON
+ * SAX handler concept, so a rapidjson::Value can be written into a sink with value.Accept(sink)
+ * and any rapidjson::Writer can be wrapped as a sink with JsonWriterSink.
+ *
+ * The streaming serialization methods (for example DocumentContext::serializeDOM(bool, JsonSink&))
+ * produce exactly the same JSON as their rapidjson::Value counterparts, but never build the
+ * complete document tree in memory.
+ */
+class JsonSink {
+public:
+    using SizeType = rapidjson::SizeType;
+
+    virtual ~JsonSink() = default;
+
+    virtual bool Null() = 0;
+    virtual bool Bool(bool b) = 0;
+    virtual bool Int(int i) = 0;
+    virtual bool Uint(unsigned u) = 0;
+    virtual bool Int64(int64_t i) = 0;
+    virtual bool Uint64(uint64_t u) = 0;
+    virtual bool Double(double d) = 0;
+    virtual bool RawNumber(const char* str, SizeType length, bool copy) = 0;
+    virtual bool String(const char* str, SizeType length, bool copy) = 0;
+    virtual bool StartObject() = 0;
+    virtual bool Key(const char* str, SizeType length, bool copy) = 0;
+    virtual bool EndObject(SizeType memberCount) = 0;
+    virtual bool StartArray() = 0;
+    virtual bool EndArray(SizeType elementCount) = 0;
+
+    bool String(const std::string& str) { return String(str.c_str(), static_cast<SizeType>(str.size()), true); }
+    bool Key(const std::string& key) { return Key(key.c_str(), static_cast<SizeType>(key.size()), true); }
+
+    /**
+     * Write a single object member whose value was built with RapidJSON.
+     * @param key The member name
+     * @param value The member value
+     * @return True if the sink accepted the member
+     */
+    bool Member(const std::string& key, const rapidjson::Value& value) {
+        return Key(key) && value.Accept(*this);
+    }
+};
+
+/**
+ * Adapts any RapidJSON writer (rapidjson::Writer, rapidjson::PrettyWriter, ...) to the JsonSink
+ * interface.  The writer must outlive the sink.
+ *
+ *     rapidjson::StringBuffer buffer;
+ *     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+ *     JsonWriterSink<rapidjson::Writer<rapidjson::StringBuffer>> sink(writer);
+ *     root->serializeDOM(false, sink);
+ */
+template<class Writer>
+class JsonWriterSink : public JsonSink {
+public:
+    explicit JsonWriterSink(Writer& writer) : mWriter(writer) {}
+
+    bool Null() override { return mWriter.Null(); }
+    bool Bool(bool b) override { return mWriter.Bool(b); }
+    bool Int(int i) override { return mWriter.Int(i); }
+    bool Uint(unsigned u) override { return mWriter.Uint(u); }
+    bool Int64(int64_t i) override { return mWriter.Int64(i); }
+    bool Uint64(uint64_t u) override { return mWriter.Uint64(u); }
+    bool Double(double d) override { return mWriter.Double(d); }
+    bool RawNumber(const char* str, SizeType length, bool copy) override { return mWriter.RawNumber(str, length, copy); }
+    bool String(const char* str, SizeType length, bool copy) override { return mWriter.String(str, length, copy); }
+    bool StartObject() override { return mWriter.StartObject(); }
+    bool Key(const char* str, SizeType length, bool copy) override { return mWriter.Key(str, length, copy); }
+    bool EndObject(SizeType memberCount) override { return mWriter.EndObject(memberCount); }
+    bool StartArray() override { return mWriter.StartArray(); }
+    bool EndArray(SizeType elementCount) override { return mWriter.EndArray(elementCount); }
+
+    using JsonSink::String;
+    using JsonSink::Key;
+
+private:
+    Writer& mWriter;
+};
+
+} // namespace apl
+
+#endif // _APL_JSON_SINK_H
@@ -0,0 +1,100 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _APL_MPSC_QUEUE_H
+#define _APL_MPSC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "apl/utils/noncopyable.h"
+
+namespace apl {
+
+/**
+ * Lock-free multiple-producer, single-consumer queue.  Any number of threads may push items;
+ * a single consumer thread takes every queued item at once with drain().
+ *
+ * Producers push onto an intrusive stack with a compare-and-swap.  The consumer detaches the
+ * whole stack with a single exchange and reverses it, so items come out in the order they were
+ * pushed.  Because the consumer never removes individual nodes there is no ABA problem.
+ *
+ * @tparam T The item type.  Must be move constructible.
+ */
+template<class T>
+class MPSCQueue : public NonCopyable {
+public:
+    MPSCQueue() = default;
+
+    ~MPSCQueue() {
+        auto node = mHead.exchange(nullptr, std::memory_order_acquire);
+        while (node) {
+            auto next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * Add an item to the queue.  Safe to call from any thread.
+     * @param item The item to add.
+     */
+    void push(T&& item) {
+        auto node = new Node{std::move(item), mHead.load(std::memory_order_relaxed)};
+        while (!mHead.compare_exchange_weak(node->next, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed))
+            ;
+    }
+
+    /**
+     * @return True if there are no items in the queue.  This is a snapshot; producers may add
+     *         items at any time.
+     */
+    bool empty() const {
+        return mHead.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /**
+     * Remove all queued items.  Only call this from the consumer thread.
+     * @return The items, oldest first.
+     */
+    std::vector<T> drain() {
+        std::vector<T> result;
+        auto node = mHead.exchange(nullptr, std::memory_order_acquire);
+        while (node) {
+            result.emplace_back(std::move(node->item));
+            auto next = node->next;
+            delete node;
+            node = next;
+        }
+
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+private:
+    struct Node {
+        T item;
+        Node *next;
+    };
+
+    std::atomic<Node*> mHead{nullptr};
+};
+
+} // namespace apl
+
+#endif // _APL_MPSC_QUEUE_H
@@ -36,7 +36,8 @@ namespace apl {
  * condition functions.
  *
  * As the tree is traversed, the universal condition is applied to proactively prune branches before the leaves have
- * been reached once a parent that fails the condition is encountered.  Conversely, the spot condition is only required
+ * been reached once a parent that fails the condition is encountered.  A component that does not contain the point is
+ * always pruned; this lets components with many children skip the ones that are not under the point.  Conversely, the spot condition is only required
  * on components that are themselves leaves or have no descendants that satisfy the spot condition.
  *
  * Correct application relies on a traversal driver function similar to:
@@ -82,6 +83,11 @@ public:
      */
     CoreComponentPtr getResult() const;
 
+    /**
+     * @return The search point in the coordinate space of the component visited last.
+     */
+    const Point& localPoint() const { return mLocalPoint; }
+
     /**
      * A condition that the resulting component and all its ancestors must satisfy.  SearchVisitor will take care of
      * ensuring all ancestors meet the condition.  Implementations should only test the component passed in as argument.
@@ -107,6 +113,7 @@ private:
     bool             mResultFound = false;
     CoreComponentPtr mPotentialResult = nullptr;
     Point            mGlobalPoint;
+    Point            mLocalPoint;
 };
 
 /**
@@ -170,6 +170,20 @@ ActionableComponent::processGestures(const PointerEvent& event, apl_time_t times
     return false;
 }
 
+void
+ActionableComponent::processPointerHistory(const PointerEvent& event, apl_time_t timestamp)
+{
+    if (mGesturesDisabled) return;
+
+    if (mActiveGesture) {
+        mActiveGesture->track(event, timestamp);
+        return;
+    }
+
+    for (auto& gesture : mGestureHandlers)
+        gesture->track(event, timestamp);
+}
+
 void
 ActionableComponent::getSupportedStandardAccessibilityActions(std::map<std::string, bool>& result) const
 {
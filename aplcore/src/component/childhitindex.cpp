@@ -0,0 +1,119 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "apl/component/childhitindex.h"
+#include "apl/component/corecomponent.h"
+
+namespace apl {
+
+// The bounding boxes are grown slightly so that rounding differences between the box and the
+// transformed point never drop a child that sits exactly under the point.
+static const float TOLERANCE = 0.5f;
+
+static bool
+isFinite(const Rect& rect)
+{
+    return std::isfinite(rect.getLeft()) && std::isfinite(rect.getRight()) &&
+           std::isfinite(rect.getTop()) && std::isfinite(rect.getBottom());
+}
+
+void
+ChildHitIndex::build(const std::vector<CoreComponentPtr>& children)
+{
+    mEntries.clear();
+    mReach.clear();
+
+    auto minX = std::numeric_limits<float>::max();
+    auto maxX = std::numeric_limits<float>::lowest();
+    auto minY = minX;
+    auto maxY = maxX;
+
+    std::vector<Rect> boxes;
+    boxes.reserve(children.size());
+    for (const auto& child : children) {
+        auto bounds = child->getCalculated(kPropertyBounds).get<Rect>();
+        const auto& transform = child->getCalculated(kPropertyTransform).get<Transform2D>();
+
+        // Same convention as the global-to-local transform: the child transform is applied
+        // with the top-left corner of the child at the origin.
+        auto box = transform.calculateAxisAlignedBoundingBox(Rect{0, 0, bounds.getWidth(), bounds.getHeight()});
+        box.offset(bounds.getTopLeft());
+        boxes.emplace_back(box);
+
+        if (!isFinite(box))
+            continue;
+
+        minX = std::min(minX, box.getLeft());
+        maxX = std::max(maxX, box.getLeft());
+        minY = std::min(minY, box.getTop());
+        maxY = std::max(maxY, box.getTop());
+    }
+
+    mHorizontal = maxX - minX > maxY - minY;
+
+    for (size_t i = 0 ; i < boxes.size() ; i++) {
+        const auto& box = boxes.at(i);
+        // A component with no area never contains a point
+        if (box.empty() || !isFinite(box))
+            continue;
+
+        if (mHorizontal)
+            mEntries.emplace_back(Entry{box.getLeft() - TOLERANCE, box.getRight() + TOLERANCE,
+                                        box.getTop() - TOLERANCE, box.getBottom() + TOLERANCE, i});
+        else
+            mEntries.emplace_back(Entry{box.getTop() - TOLERANCE, box.getBottom() + TOLERANCE,
+                                        box.getLeft() - TOLERANCE, box.getRight() + TOLERANCE, i});
+    }
+
+    std::stable_sort(mEntries.begin(), mEntries.end(), [](const Entry& a, const Entry& b) {
+        return a.low < b.low;
+    });
+
+    mReach.reserve(mEntries.size());
+    auto reach = std::numeric_limits<float>::lowest();
+    for (const auto& entry : mEntries) {
+        reach = std::max(reach, entry.high);
+        mReach.emplace_back(reach);
+    }
+}
+
+const std::vector<size_t>&
+ChildHitIndex::query(const Point& point) const
+{
+    mResult.clear();
+
+    auto along = mHorizontal ? point.getX() : point.getY();
+    auto across = mHorizontal ? point.getY() : point.getX();
+
+    // Entries before "first" end before the point; entries from "last" on start after it.
+    auto first = std::lower_bound(mReach.begin(), mReach.end(), along) - mReach.begin();
+    auto last = std::upper_bound(mEntries.begin(), mEntries.end(), along,
+                                 [](float value, const Entry& entry) { return value < entry.low; }) - mEntries.begin();
+
+    for (auto i = first ; i < last ; i++) {
+        const auto& entry = mEntries.at(i);
+        if (along <= entry.high && across >= entry.crossLow && across <= entry.crossHigh)
+            mResult.emplace_back(entry.index);
+    }
+
+    std::sort(mResult.begin(), mResult.end(), std::greater<size_t>());
+    return mResult;
+}
+
+} // namespace apl
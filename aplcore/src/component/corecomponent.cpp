@@ -41,6 +41,7 @@
 #include "apl/time/timemanager.h"
 #include "apl/touch/pointerevent.h"
 #include "apl/utils/hash.h"
+#include "apl/utils/make_unique.h"
 #include "apl/utils/searchvisitor.h"
 #include "apl/utils/session.h"
 #include "apl/utils/stickychildrentree.h"
@@ -75,6 +76,9 @@ const static bool DEBUG_LAYOUTDIRECTION = false;
 const static bool DEBUG_PADDING = false;
 const static bool DEBUG_MEASUREMENT = false;
 
+// Components with at least this many children index them for hit-testing
+static const size_t HIT_INDEX_MIN_CHILDREN = 16;
+
 using ComponentDependant = TypedDependant<CoreComponent, PropertyKey>;
 
 /**
@@ -242,6 +246,7 @@ CoreComponent::releaseSelf()
     RecalculateTarget::removeUpstreamDependencies();
     mParent = nullptr;
     mChildren.clear();
+    mHitIndex = nullptr;
     clearActiveStateSelf();
 }
 
@@ -292,6 +297,53 @@ CoreComponent::raccept(Visitor<CoreComponent>& visitor) const
     visitor.pop();
 }
 
+void
+CoreComponent::rsearch(SearchVisitor& visitor) const
+{
+    visitor.visit(*this);
+    visitor.push();
+    rsearchChildren(visitor);
+    visitor.pop();
+}
+
+void
+CoreComponent::markChildLayoutStale()
+{
+    mHitIndexStale = true;
+    mContext->focusManager().invalidateFocusables();
+}
+
+void
+CoreComponent::rsearchChildren(SearchVisitor& visitor, const std::function<bool(size_t)>& filter) const
+{
+    if (visitor.isAborted())
+        return;
+
+    // A short list of children is cheaper to walk than to index
+    if (mChildren.size() < HIT_INDEX_MIN_CHILDREN) {
+        for (auto i = mChildren.size(); i-- > 0 && !visitor.isAborted(); )
+            if (!filter || filter(i))
+                mChildren.at(i)->rsearch(visitor);
+        return;
+    }
+
+    auto& mutableThis = const_cast<CoreComponent&>(*this);
+    if (!mHitIndex)
+        mutableThis.mHitIndex = std::make_unique<ChildHitIndex>();
+    if (mHitIndexStale) {
+        mutableThis.mHitIndex->build(mChildren);
+        mutableThis.mHitIndexStale = false;
+    }
+
+    // The children are positioned in the scrolled content of this component
+    for (auto index : mHitIndex->query(visitor.localPoint() + scrollPosition())) {
+        if (visitor.isAborted())
+            break;
+        if (!filter || filter(index))
+            mChildren.at(index)->rsearch(visitor);
+    }
+}
+
 template<typename Pre, typename Post>
 void
 CoreComponent::traverse(const Pre& pre, const Post& post)
@@ -330,7 +382,7 @@ ComponentPtr
 CoreComponent::findComponentAtPosition(const Point& position) const
 {
     auto visitor = TopAtPosition(position);
-    raccept(visitor);
+    rsearch(visitor);
     return visitor.getResult();
 }
 
@@ -560,6 +612,7 @@ CoreComponent::insertChild(const CoreComponentPtr& child, size_t index, bool use
 
     coreChild->markGlobalToLocalTransformStale();
     markDisplayedChildrenStale(useDirtyFlag);
+    markChildLayoutStale();
     setVisualContextDirty();
 
     // Update the position: sticky components tree
@@ -616,6 +669,7 @@ CoreComponent::removeChildAfterMarkedRemoved(const CoreComponentPtr& child, size
 
     markDisplayedChildrenStale(useDirtyFlag);
     mDisplayedChildren.clear();
+    markChildLayoutStale();
 
     if (useDirtyFlag) setVisualContextDirty();
 
@@ -997,6 +1051,7 @@ CoreComponent::handlePropertyChange(const ComponentPropDef& def, const Object& v
              ||(def.key == kPropertyOpacity && ((value.asNumber() == 0) != (previous.asNumber() == 0))))) {
 
                 mParent->markDisplayedChildrenStale(true);
+                mParent->markChildLayoutStale();
         }
 
         // Properties with the kPropVisualContext flag the visual context as dirty
@@ -1623,8 +1678,10 @@ CoreComponent::processLayoutChanges(bool useDirtyFlag, bool first)
         mCalculated.set(kPropertyBounds, std::move(rect));
         markGlobalToLocalTransformStale();
         markDisplayedChildrenStale(useDirtyFlag);
-        if (mParent)
+        if (mParent) {
             mParent->markDisplayedChildrenStale(useDirtyFlag);
+            mParent->markChildLayoutStale();
+        }
         setVisualContextDirty();
         if (useDirtyFlag)
             setDirty(kPropertyBounds);
@@ -1874,6 +1931,7 @@ CoreComponent::fixTransform(bool useDirtyFlag)
         // transform change make parent display stale
         if (mParent) {
             mParent->markDisplayedChildrenStale(useDirtyFlag);
+            mParent->markChildLayoutStale();
         }
         setVisualContextDirty();
         if (useDirtyFlag)
@@ -1968,21 +2026,52 @@ CoreComponent::calculateChildrenVisualLayer(const std::map<int, float>& visibleI
     return result;
 }
 
-rapidjson::Value
-CoreComponent::serialize(rapidjson::Document::AllocatorType& allocator) const
+void
+CoreComponent::serializeMembers(rapidjson::Value& out, rapidjson::Document::AllocatorType& allocator,
+                                bool extended) const
 {
-    rapidjson::Value component(rapidjson::kObjectType);
+    out.AddMember("id", rapidjson::Value(mUniqueId.c_str(), allocator).Move(), allocator);
 
-    component.AddMember("id", rapidjson::Value(mUniqueId.c_str(), allocator).Move(), allocator);
-    component.AddMember("type", getType(), allocator);
+    if (!extended) {
+        out.AddMember("type", getType(), allocator);
+
+        for (const auto& pds : propDefSet()) {
+            if ((pds.second.flags & kPropOut) != 0 || (pds.second.flags & kPropRuntimeState) != 0)
+                out.AddMember(
+                    rapidjson::StringRef(pds.second.names[0].c_str()),   // We assume long-lived strings here
+                    mCalculated.get(pds.first).serialize(allocator),
+                    allocator);
+        }
+        return;
+    }
+
+    out.AddMember("type", rapidjson::StringRef(sComponentTypeBimap.at(getType()).c_str()), allocator);
+
+    out.AddMember("__id", rapidjson::Value(mId.c_str(), allocator), allocator);
+    out.AddMember("__inheritParentState", mInheritParentState, allocator);
+    out.AddMember("__style", rapidjson::Value(mStyle.c_str(), allocator), allocator);
+    out.AddMember("__path", rapidjson::Value(mPath.toString().c_str(), allocator), allocator);
 
     for (const auto& pds : propDefSet()) {
-        if ((pds.second.flags & kPropOut) != 0 || (pds.second.flags & kPropRuntimeState) != 0)
-            component.AddMember(
+        if (pds.second.map) {
+            out.AddMember(
+                rapidjson::StringRef(pds.second.names[0].c_str()),   // We assume long-lived strings here
+                rapidjson::StringRef(pds.second.map->at(mCalculated.get(pds.first).asInt()).c_str()),
+                allocator);
+        } else {
+            out.AddMember(
                 rapidjson::StringRef(pds.second.names[0].c_str()),   // We assume long-lived strings here
                 mCalculated.get(pds.first).serialize(allocator),
                 allocator);
+        }
     }
+}
+
+rapidjson::Value
+CoreComponent::serialize(rapidjson::Document::AllocatorType& allocator) const
+{
+    rapidjson::Value component(rapidjson::kObjectType);
+    serializeMembers(component, allocator, false);
 
     if (!mChildren.empty()) {
         rapidjson::Value children(rapidjson::kArrayType);
@@ -1991,6 +2080,7 @@ CoreComponent::serialize(rapidjson::Document::AllocatorType& allocator) const
         component.AddMember("children", children, allocator);
     }
 
+    serializeExtra(component, allocator);
     return component;
 }
 
@@ -1998,28 +2088,7 @@ rapidjson::Value
 CoreComponent::serializeAll(rapidjson::Document::AllocatorType& allocator) const
 {
     rapidjson::Value component(rapidjson::kObjectType);
-
-    component.AddMember("id", rapidjson::Value(mUniqueId.c_str(), allocator).Move(), allocator);
-    component.AddMember("type", rapidjson::StringRef(sComponentTypeBimap.at(getType()).c_str()), allocator);
-
-    component.AddMember("__id", rapidjson::Value(mId.c_str(), allocator), allocator);
-    component.AddMember("__inheritParentState", mInheritParentState, allocator);
-    component.AddMember("__style", rapidjson::Value(mStyle.c_str(), allocator), allocator);
-    component.AddMember("__path", rapidjson::Value(mPath.toString().c_str(), allocator), allocator);
-
-    for (const auto& pds : propDefSet()) {
-        if (pds.second.map) {
-            component.AddMember(
-                rapidjson::StringRef(pds.second.names[0].c_str()),   // We assume long-lived strings here
-                rapidjson::StringRef(pds.second.map->at(mCalculated.get(pds.first).asInt()).c_str()),
-                allocator);
-        } else {
-            component.AddMember(
-                rapidjson::StringRef(pds.second.names[0].c_str()),   // We assume long-lived strings here
-                mCalculated.get(pds.first).serialize(allocator),
-                allocator);
-        }
-    }
+    serializeMembers(component, allocator, true);
 
     if (!mChildren.empty()) {
         rapidjson::Value children(rapidjson::kArrayType);
@@ -2031,6 +2100,64 @@ CoreComponent::serializeAll(rapidjson::Document::AllocatorType& allocator) const
     return component;
 }
 
+void
+CoreComponent::serialize(JsonSink& sink) const
+{
+    serializeStream(sink, false);
+}
+
+void
+CoreComponent::serializeAll(JsonSink& sink) const
+{
+    serializeStream(sink, true);
+}
+
+/**
+ * Write the members of a serialized object into the sink.
+ * @return The number of members written.
+ */
+static rapidjson::SizeType
+writeMembers(JsonSink& sink, const rapidjson::Value& object)
+{
+    for (const auto& m : object.GetObject()) {
+        sink.Key(m.name.GetString(), m.name.GetStringLength(), false);
+        m.value.Accept(sink);
+    }
+    return object.MemberCount();
+}
+
+void
+CoreComponent::serializeStream(JsonSink& sink, bool extended) const
+{
+    rapidjson::SizeType memberCount = 0;
+    sink.StartObject();
+
+    // Only the members of this component are materialized; they are released before the
+    // children are streamed.
+    {
+        rapidjson::Document scratch(rapidjson::kObjectType);
+        serializeMembers(scratch, scratch.GetAllocator(), extended);
+        memberCount += writeMembers(sink, scratch);
+    }
+
+    if (!mChildren.empty()) {
+        sink.Key("children", 8, false);
+        sink.StartArray();
+        for (const auto& child : mChildren)
+            child->serializeStream(sink, extended);
+        sink.EndArray(static_cast<rapidjson::SizeType>(mChildren.size()));
+        memberCount++;
+    }
+
+    if (!extended) {
+        rapidjson::Document scratch(rapidjson::kObjectType);
+        serializeExtra(scratch, scratch.GetAllocator());
+        memberCount += writeMembers(sink, scratch);
+    }
+
+    sink.EndObject(memberCount);
+}
+
 rapidjson::Value
 CoreComponent::serializeDirty(rapidjson::Document::AllocatorType& allocator) {
     rapidjson::Value component(rapidjson::kObjectType);
@@ -2079,6 +2206,48 @@ CoreComponent::serializeVisualContextInternal(
     rapidjson::Value tags(rapidjson::kObjectType);
     actionable |= getTags(tags, allocator);
 
+    // Leaf components are cheap to serialize, so only subtrees are cached
+    if (mChildren.empty()) {
+        buildVisualContextFragment(outArray, allocator, realOpacity, visibility, visibleRect,
+                                   visualLayer, tags, actionable);
+        return;
+    }
+
+    auto globalBounds = getGlobalBounds();
+    const auto& cache = mVisualContextCache;
+    if (cache && cache->realOpacity == realOpacity && cache->visibility == visibility &&
+        cache->visibleRect == visibleRect && cache->globalBounds == globalBounds &&
+        cache->visualLayer == visualLayer && cache->tags == tags) {
+        for (const auto& entry : cache->fragment.GetArray())
+            outArray.PushBack(rapidjson::Value(entry, allocator), allocator);
+        return;
+    }
+
+    auto updated = std::unique_ptr<VisualContextCache>(new VisualContextCache());
+    updated->realOpacity = realOpacity;
+    updated->visibility = visibility;
+    updated->visibleRect = visibleRect;
+    updated->globalBounds = globalBounds;
+    updated->visualLayer = visualLayer;
+    updated->tags.CopyFrom(tags, updated->tags.GetAllocator());
+
+    rapidjson::Value fragment(rapidjson::kArrayType);
+    buildVisualContextFragment(fragment, allocator, realOpacity, visibility, visibleRect,
+                               visualLayer, tags, actionable);
+    updated->fragment.CopyFrom(fragment, updated->fragment.GetAllocator());
+    mVisualContextCache = std::move(updated);
+
+    for (auto& entry : fragment.GetArray())
+        outArray.PushBack(entry, allocator);
+}
+
+void
+CoreComponent::buildVisualContextFragment(
+    rapidjson::Value &outArray, rapidjson::Document::AllocatorType& allocator, float realOpacity,
+    float visibility, const Rect& visibleRect, int visualLayer, rapidjson::Value& tags, bool actionable)
+{
+    auto parentInDocument = getParentIfInDocument();
+
     bool isTopLevelElement = !mParent || !mParent->includeChildrenInVisualContext();
     if (isTopLevelElement) {
         tags.AddMember("viewport", rapidjson::Value(rapidjson::kObjectType), allocator);
@@ -2166,6 +2335,10 @@ CoreComponent::getVisualContextType() const
 
 void
 CoreComponent::setVisualContextDirty() {
+    // cached fragments of this component and every ancestor embed the stale entries
+    for (auto component = this; component; component = component->mParent.get())
+        component->mVisualContextCache.reset();
+
     // set this component as dirty visual context
     mContext->setDirtyVisualContext(shared_from_this());
 }
@@ -0,0 +1,139 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "apl/component/dirtypropertyencoder.h"
+
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include "apl/component/component.h"
+#include "apl/primitives/color.h"
+#include "apl/primitives/rect.h"
+#include "apl/primitives/styledtext.h"
+#include "apl/primitives/transform2d.h"
+
+namespace apl {
+
+const std::vector<uint8_t>&
+DirtyPropertyEncoder::encode(const std::set<ComponentPtr>& components)
+{
+    mBuffer.clear();
+    put<uint32_t>(DIRTY_PROPERTY_MAGIC);
+    put<uint16_t>(DIRTY_PROPERTY_VERSION);
+    put<uint16_t>(0);
+    put<uint32_t>(static_cast<uint32_t>(components.size()));
+
+    for (const auto& component : components) {
+        const auto& dirty = component->getDirty();
+        putString(component->getUniqueId());
+        put<uint32_t>(static_cast<uint32_t>(dirty.size()));
+        for (const auto& key : dirty) {
+            put<int32_t>(key);
+            encodeValue(component->getCalculated(key));
+        }
+    }
+
+    return mBuffer;
+}
+
+void
+DirtyPropertyEncoder::encodeValue(const Object& value)
+{
+    if (value.isNull()) {
+        put<uint8_t>(kDirtyValueNull);
+    }
+    else if (value.isBoolean()) {
+        put<uint8_t>(kDirtyValueBoolean);
+        put<uint8_t>(value.getBoolean() ? 1 : 0);
+    }
+    else if (value.isNumber()) {
+        put<uint8_t>(kDirtyValueNumber);
+        put<double>(value.getDouble());
+    }
+    else if (value.isString()) {
+        put<uint8_t>(kDirtyValueString);
+        putString(value.getString());
+    }
+    else if (value.is<Color>()) {
+        put<uint8_t>(kDirtyValueColor);
+        put<uint32_t>(value.getColor());
+    }
+    else if (value.is<Rect>()) {
+        const auto& rect = value.get<Rect>();
+        put<uint8_t>(kDirtyValueRect);
+        put<float>(rect.getX());
+        put<float>(rect.getY());
+        put<float>(rect.getWidth());
+        put<float>(rect.getHeight());
+    }
+    else if (value.is<Transform2D>()) {
+        put<uint8_t>(kDirtyValueTransform2D);
+        for (const auto& f : value.get<Transform2D>().get())
+            put<float>(f);
+    }
+    else if (value.is<StyledText>()) {
+        encodeStyledText(value);
+    }
+    else {
+        encodeJson(value);
+    }
+}
+
+void
+DirtyPropertyEncoder::encodeStyledText(const Object& value)
+{
+    const auto& styledText = value.get<StyledText>();
+    put<uint8_t>(kDirtyValueStyledText);
+    putString(styledText.mText);
+    put<uint32_t>(static_cast<uint32_t>(styledText.mSpans.size()));
+    for (const auto& span : styledText.mSpans) {
+        put<uint8_t>(static_cast<uint8_t>(span.type));
+        put<uint32_t>(static_cast<uint32_t>(span.start));
+        put<uint32_t>(static_cast<uint32_t>(span.end));
+        put<uint32_t>(static_cast<uint32_t>(span.attributes.size()));
+        for (const auto& attribute : span.attributes) {
+            put<uint8_t>(static_cast<uint8_t>(attribute.name));
+            // Attribute values are colors and font sizes; anything else that is not a scalar
+            // falls back to JSON
+            const auto& v = attribute.value;
+            if (v.isNull() || v.isBoolean() || v.isNumber() || v.isString() || v.is<Color>())
+                encodeValue(v);
+            else
+                encodeJson(v);
+        }
+    }
+}
+
+void
+DirtyPropertyEncoder::encodeJson(const Object& value)
+{
+    rapidjson::Document doc;
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    value.serializeDirty(doc.GetAllocator()).Accept(writer);
+
+    put<uint8_t>(kDirtyValueJson);
+    put<uint32_t>(static_cast<uint32_t>(buffer.GetSize()));
+    mBuffer.insert(mBuffer.end(), buffer.GetString(), buffer.GetString() + buffer.GetSize());
+}
+
+void
+DirtyPropertyEncoder::putString(const std::string& value)
+{
+    put<uint32_t>(static_cast<uint32_t>(value.size()));
+    mBuffer.insert(mBuffer.end(), value.begin(), value.end());
+}
+
+} // namespace apl
@@ -22,6 +22,7 @@
 #include "apl/livedata/layoutrebuilder.h"
 #include "apl/time/sequencer.h"
 #include "apl/time/timemanager.h"
+#include "apl/utils/searchvisitor.h"
 #include "apl/utils/session.h"
 #include "apl/utils/tracing.h"
 
@@ -400,6 +401,22 @@ MultiChildScrollableComponent::raccept(Visitor<CoreComponent>& visitor) const
     visitor.pop();
 }
 
+void
+MultiChildScrollableComponent::rsearch(SearchVisitor& visitor) const
+{
+    visitor.visit(*this);
+    visitor.push();
+    if (!mEnsuredChildren.empty()) {
+        rsearchChildren(visitor, [&](size_t index) {
+            if (!mEnsuredChildren.contains(static_cast<int>(index)))
+                return false;
+            const auto& child = mChildren.at(index);
+            return child->isAttached() && !child->getCalculated(kPropertyBounds).get<Rect>().empty();
+        });
+    }
+    visitor.pop();
+}
+
 std::map<int, float>
 MultiChildScrollableComponent::getChildrenVisibility(float realOpacity, const Rect &visibleRect) const
 {
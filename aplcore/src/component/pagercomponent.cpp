@@ -27,6 +27,7 @@
 #include "apl/time/timemanager.h"
 #include "apl/touch/gestures/pagerflinggesture.h"
 #include "apl/touch/utils/pagemovehandler.h"
+#include "apl/utils/searchvisitor.h"
 
 namespace apl {
 
@@ -218,6 +219,7 @@ PagerComponent::setPage(int page)
     mCalculated.set(kPropertyCurrentPage, page);
     setVisualContextDirty();
     attachPageAndReportLoaded(page);
+    markChildLayoutStale();
 
     setDirty(kPropertyCurrentPage);
 }
@@ -236,6 +238,7 @@ PagerComponent::setPageImmediate(int pageIndex)
     mCalculated.set(kPropertyCurrentPage, pageIndex);
     setVisualContextDirty();
     attachPageAndReportLoaded(pageIndex);
+    markChildLayoutStale();
     setDirty(kPropertyCurrentPage);
 
     if (allowEventHandlers())
@@ -669,6 +672,19 @@ PagerComponent::raccept(Visitor<CoreComponent>& visitor) const {
     visitor.pop();
 }
 
+void
+PagerComponent::rsearch(SearchVisitor& visitor) const {
+    visitor.visit(*this);
+    visitor.push();
+    int currentPage = pagePosition();
+    if (!visitor.isAborted() && currentPage >= 0 && currentPage < getChildCount()) {
+        auto child = mChildren.at(currentPage);
+        if (child != nullptr)
+            child->rsearch(visitor);
+    }
+    visitor.pop();
+}
+
 bool
 PagerComponent::insertChild(const CoreComponentPtr& child, size_t index, bool useDirtyFlag)
 {
@@ -554,14 +554,12 @@ VideoComponent::getVisualContextType() const
     return getCalculated(kPropertySource).empty() ? VISUAL_CONTEXT_TYPE_EMPTY : VISUAL_CONTEXT_TYPE_VIDEO;
 }
 
-rapidjson::Value
-VideoComponent::serialize(rapidjson::Document::AllocatorType& allocator) const
+void
+VideoComponent::serializeExtra(rapidjson::Value& out, rapidjson::Document::AllocatorType& allocator) const
 {
-    auto component = CoreComponent::serialize(allocator);
     if (mMediaPlayer) {
-        component.AddMember("__mediaPlayer", mMediaPlayer->serialize(allocator), allocator);
+        out.AddMember("__mediaPlayer", mMediaPlayer->serialize(allocator), allocator);
     }
-    return component;
 }
 
 #ifdef SCENEGRAPH
@@ -28,6 +28,7 @@
 #include "apl/media/coremediamanager.h"
 #include "apl/media/mediaplayerfactory.h"
 #include "apl/time/coretimemanager.h"
+#include "apl/time/timerwheel.h"
 #include "apl/utils/corelocalemethods.h"
 #include "apl/utils/session.h"
 
@@ -188,6 +189,7 @@ RootConfig::propDefSet() const
             {RootProperty::kUEScrollerDeceleration,                      0.175,                                         asNumber},
             {RootProperty::kSendEventAdditionalFlags,                    Object::EMPTY_MAP(),                           asAny},
             {RootProperty::kTextMeasurementCacheLimit,                   500,                                           asInteger},
+            {RootProperty::kExpressionCacheLimit,                        500,                                           asInteger},
             {RootProperty::kInitialDisplayState,                         DEFAULT_DISPLAY_STATE,                         sDisplayStateMap},
         });
     return sRootProperties;
@@ -237,6 +239,17 @@ RootConfig::session(const SessionPtr& session) {
     return *this;
 }
 
+RootConfig&
+RootConfig::timerBackend(TimerBackend backend)
+{
+    std::unique_ptr<TimerQueue> timers;
+    if (backend == kTimerBackendWheel)
+        timers.reset(new TimerWheel());
+
+    mTimeManager = std::make_shared<CoreTimeManager>(0, std::move(timers));
+    return *this;
+}
+
 RootConfig&
 RootConfig::set(const std::string& name, const Object& object)
 {
@@ -56,6 +56,7 @@ Bimap<int, std::string> sRootPropertyBimap = {
         { RootProperty::kInitialDisplayState,                         "initialDisplayState"},
         { RootProperty::kLayoutDirection,                             "layoutDirection"},
         { RootProperty::kTextMeasurementCacheLimit,                   "textMeasurementCacheLimit"},
+        { RootProperty::kExpressionCacheLimit,                        "expressionCacheLimit"},
         { RootProperty::kScreenMode,                                  "screenMode" },
         { RootProperty::kScreenReader,                                "screenReader" },
         { RootProperty::kPointerInactivityTimeout,                    "pointerInactivityTimeout" },
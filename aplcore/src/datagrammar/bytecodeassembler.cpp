@@ -21,8 +21,6 @@
 #include "apl/datagrammar/databindingerrors.h"
 #include "apl/datagrammar/databindingrules.h"
 
-#include "apl/primitives/boundsymbol.h"
-
 #include "apl/engine/context.h"
 #include "apl/utils/log.h"
 #include "apl/utils/session.h"
@@ -71,8 +69,12 @@ ByteCodeAssembler::parse(const Context& context, const std::string& value)
     if (value.find("${") == std::string::npos && value.find("#{") == std::string::npos)
         return value;
 
+    auto cache = context.expressionCache();
+    if (cache && cache->has(value))
+        return cache->get(value)->link(context);
+
     pegtl::string_input<> in(value, "");
-    datagrammar::ByteCodeAssembler assembler(context);
+    datagrammar::ByteCodeAssembler assembler;
     fail_state failState;
 
     // Only support #{...} evaluation in version 2023.2 and higher.
@@ -90,15 +92,17 @@ ByteCodeAssembler::parse(const Context& context, const std::string& value)
         }
 
     } else {
-        return assembler.retrieve();
+        // Syntax errors are not cached so that every use of a bad expression is reported
+        auto result = assembler.retrieve();
+        if (cache)
+            cache->put(value, result);
+        return result->link(context);
     }
 
     return value;
 }
 
-ByteCodeAssembler::ByteCodeAssembler(const Context& context)
-    : mContext(std::const_pointer_cast<Context>(context.shared_from_this())),
-      mCode{CodeUnit(mContext)}
+ByteCodeAssembler::ByteCodeAssembler()
 {
     mInstructionRef = &mCode.byteCode->mInstructions;
     mDataRef = &mCode.byteCode->mData;
@@ -106,7 +110,7 @@ ByteCodeAssembler::ByteCodeAssembler(const Context& context)
 }
 
 
-Object
+ByteCodeTemplatePtr
 ByteCodeAssembler::retrieve() const
 {
     return mCode.byteCode;
@@ -136,24 +140,22 @@ ByteCodeAssembler::loadImmediate(bciValueType value)
 void
 ByteCodeAssembler::loadGlobal(const std::string& name)
 {
-    auto cr = mContext->find(name);
-    if (cr.empty()) { // Not found -> load NULL
-        mInstructionRef->emplace_back(
-            ByteCodeInstruction{BC_OPCODE_LOAD_CONSTANT, BC_CONSTANT_NULL});
-        return;
-    }
-
+    // The symbol is looked up when the template is linked to a context
     auto len = asBCI(mDataRef->size());
-    // Immutable globals can be replaced by a constant value
-    if (!cr.object().isMutable()) {
-        mDataRef->emplace_back(cr.object().value());
-        mInstructionRef->emplace_back(ByteCodeInstruction{BC_OPCODE_LOAD_DATA, len});
-        return;
-    }
+    mCode.byteCode->mPlaceholders.emplace_back(
+        ByteCodeTemplate::Placeholder{true, name, len, mInstructionRef->size()});
+    mDataRef->emplace_back(Object::NULL_OBJECT());
+    mInstructionRef->emplace_back(ByteCodeInstruction{BC_OPCODE_LOAD_DATA, len});
+}
 
-    // Mutable globals have a bound symbol
-    mDataRef->emplace_back(BoundSymbol(cr.context(), name));
-    mInstructionRef->emplace_back(ByteCodeInstruction{BC_OPCODE_LOAD_BOUND_SYMBOL, len});
+void
+ByteCodeAssembler::loadDimension(const std::string& value)
+{
+    // Relative dimensions depend on the metrics of the context
+    auto len = asBCI(mDataRef->size());
+    mCode.byteCode->mPlaceholders.emplace_back(ByteCodeTemplate::Placeholder{false, value, len, 0});
+    mDataRef->emplace_back(Object::NULL_OBJECT());
+    mInstructionRef->emplace_back(ByteCodeInstruction{BC_OPCODE_LOAD_DATA, len});
 }
 
 void
@@ -0,0 +1,92 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "apl/datagrammar/bytecodetemplate.h"
+
+#include "apl/engine/context.h"
+#include "apl/primitives/boundsymbol.h"
+#include "apl/primitives/dimension.h"
+
+namespace apl {
+namespace datagrammar {
+
+std::shared_ptr<ByteCode>
+ByteCodeTemplate::link(const Context& context) const
+{
+    auto contextPtr = std::const_pointer_cast<Context>(context.shared_from_this());
+    auto byteCode = std::make_shared<ByteCode>(contextPtr);
+    byteCode->mInstructions = mInstructions;
+    byteCode->mData = mData;
+
+    auto& instructions = byteCode->mInstructions;
+    auto& data = byteCode->mData;
+    std::vector<bool> unused;
+
+    for (const auto& placeholder : mPlaceholders) {
+        if (!placeholder.global) {
+            data[placeholder.dataIndex] = Dimension(context, placeholder.text);
+            continue;
+        }
+
+        auto& instruction = instructions[placeholder.instructionIndex];
+        auto cr = contextPtr->find(placeholder.text);
+        if (cr.empty()) { // Not found -> load NULL
+            instruction = ByteCodeInstruction{BC_OPCODE_LOAD_CONSTANT, BC_CONSTANT_NULL};
+            if (unused.empty())
+                unused.resize(data.size(), false);
+            unused[placeholder.dataIndex] = true;
+        } else if (!cr.object().isMutable()) {
+            // Immutable globals can be replaced by a constant value
+            data[placeholder.dataIndex] = cr.object().value();
+        } else {
+            // Mutable globals have a bound symbol
+            data[placeholder.dataIndex] = BoundSymbol(cr.context(), placeholder.text);
+            instruction.type = BC_OPCODE_LOAD_BOUND_SYMBOL;
+        }
+    }
+
+    if (unused.empty())
+        return byteCode;
+
+    // Drop the slots of missing globals so the result matches a direct parse
+    std::vector<bciValueType> remap(data.size());
+    size_t count = 0;
+    for (size_t i = 0 ; i < data.size() ; i++) {
+        remap[i] = asBCI(count);
+        if (unused[i])
+            continue;
+        if (count != i)
+            data[count] = std::move(data[i]);
+        count++;
+    }
+    data.resize(count);
+
+    for (auto& instruction : instructions) {
+        switch (instruction.type) {
+            case BC_OPCODE_LOAD_DATA:
+            case BC_OPCODE_LOAD_BOUND_SYMBOL:
+            case BC_OPCODE_ATTRIBUTE_ACCESS:
+                instruction.value = remap[instruction.value];
+                break;
+            default:
+                break;
+        }
+    }
+
+    return byteCode;
+}
+
+} // namespace datagrammar
+} // namespace apl
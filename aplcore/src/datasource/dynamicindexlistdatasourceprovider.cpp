@@ -17,6 +17,7 @@
 #include "apl/datasource/datasource.h"
 #include "apl/datasource/datasourceprovider.h"
 #include "apl/engine/evaluate.h"
+#include "apl/livedata/columnarbatch.h"
 #include "apl/time/timemanager.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
@@ -56,11 +57,64 @@ DynamicIndexListDataSourceConnection::DynamicIndexListDataSourceConnection(
 
 void
 DynamicIndexListDataSourceConnection::fetch(size_t index, size_t count) {
+    if (!mScheduler.admit(index, count))
+        return;
+
     int idx = index + mMinimumInclusiveIndex;
 
     auto requestData = ObjectMap{{START_INDEX, idx}, {COUNT, count}};
 
-    sendFetchRequest(requestData);
+    auto correlationToken = sendFetchRequest(requestData);
+    if (!correlationToken.empty())
+        mScheduler.issued(correlationToken, index, count, currentTime());
+}
+
+/**
+ * Rows of a ColumnarBatch hold literal values, so a response made only of batch rows can skip
+ * data-binding evaluation and keep the rows as views over the batch.
+ */
+static bool
+isColumnarBatch(const Object& data)
+{
+    if (!data.isArray() || data.empty())
+        return false;
+
+    for (std::uint64_t i = 0 ; i < data.size() ; i++)
+        if (!data.at(i).is<ColumnarRowData>())
+            return false;
+
+    return true;
+}
+
+size_t
+DynamicIndexListDataSourceConnection::evict(std::ptrdiff_t first, std::ptrdiff_t last) {
+    LiveArrayPtr liveArray = mLiveArray.lock();
+    if (!liveArray)
+        return 0;
+
+    auto begin = static_cast<std::ptrdiff_t>(mOffset);
+    auto end = static_cast<std::ptrdiff_t>(mOffset + liveArray->size());
+    if (last < begin || first >= end)
+        return 0;
+
+    // Drop at least a chunk at a time, and never the side a pending fetch is about to extend.
+    auto chunk = std::max<std::ptrdiff_t>(1, mConfiguration.cacheChunkSize);
+    size_t evicted = 0;
+
+    if (end - (last + 1) >= chunk && !mScheduler.hasPendingIn(last + 1, SIZE_MAX)) {
+        auto count = end - (last + 1);
+        liveArray->remove(last + 1 - begin, count);
+        evicted += count;
+    }
+
+    if (first - begin >= chunk && !mScheduler.hasPendingIn(0, first)) {
+        auto count = first - begin;
+        liveArray->remove(0, count);
+        mOffset += count;
+        evicted += count;
+    }
+
+    return evicted;
 }
 
 bool
@@ -69,7 +123,7 @@ DynamicIndexListDataSourceConnection::processLazyLoad(int index, const Object& d
     if (!context)
         return false;
 
-    auto items = evaluateNested(*context, data);
+    auto items = isColumnarBatch(data) ? data : evaluateNested(*context, data);
 
     bool result = false;
     bool outOfRange = false;
@@ -184,7 +238,84 @@ DynamicIndexListDataSourceConnection::processUpdate(DynamicIndexListUpdateType t
     if (!result) {
         constructAndReportError(context, ERROR_REASON_LIST_INDEX_OUT_OF_RANGE, index,
                 "Requested index out of bounds.");
+    } else if (type != kTypeReplace) {
+        mScheduler.forgetRanges();
+    }
+    return result;
+}
+
+bool
+DynamicIndexListDataSourceConnection::processUpdateRun(const std::vector<DynamicIndexListUpdate>& updates) {
+    auto context = mContext.lock();
+    LiveArrayPtr liveArray = mLiveArray.lock();
+    if (!context || !liveArray || updates.empty())
+        return false;
+
+    const auto& first = updates.front();
+    if (first.index < mMinimumInclusiveIndex)
+        return false;
+
+    size_t idx = first.index - mMinimumInclusiveIndex;
+    auto lowerBound = mOffset;
+    auto upperBound = mOffset + liveArray->size();
+    if (idx < lowerBound)
+        return false;
+
+    ObjectArray items;
+    size_t count = 0;
+    for (const auto& update : updates) {
+        switch (update.type) {
+            case kTypeInsert:
+            case kTypeReplace:
+                items.emplace_back(evaluateNested(*context, update.data));
+                count++;
+                break;
+            case kTypeInsertMultiple: {
+                auto evaluated = evaluateNested(*context, update.data);
+                if (!evaluated.isArray())
+                    return false;
+                items.insert(items.end(), evaluated.getArray().begin(), evaluated.getArray().end());
+                count += evaluated.size();
+                break;
+            }
+            case kTypeDelete:
+                count++;
+                break;
+            case kTypeDeleteMultiple:
+                if (update.count <= 0)
+                    return false;
+                count += update.count;
+                break;
+        }
+    }
+
+    bool result = false;
+    switch (first.type) {
+        case kTypeInsert:
+        case kTypeInsertMultiple:
+            if (idx > upperBound)
+                return false;
+            result = insert(idx, items);
+            if (result && mMaximumExclusiveIndex < INT_MAX)
+                mMaximumExclusiveIndex += count;
+            break;
+        case kTypeReplace:
+            if (idx + count > upperBound)
+                return false;
+            result = update(idx, items, true);
+            break;
+        case kTypeDelete:
+        case kTypeDeleteMultiple:
+            if (idx + count > upperBound)
+                return false;
+            result = remove(idx, count);
+            if (result && mMaximumExclusiveIndex < INT_MAX)
+                mMaximumExclusiveIndex -= count;
+            break;
     }
+
+    if (result && first.type != kTypeReplace)
+        mScheduler.forgetRanges();
     return result;
 }
 
@@ -237,6 +368,8 @@ DynamicIndexListDataSourceConnection::updateBounds(
         liveArray->remove(liveArray->size() - topShrink, topShrink);
     }
 
+    if (wasChanged)
+        mScheduler.forgetRanges();
     return wasChanged;
 }
 
@@ -331,6 +464,85 @@ DynamicIndexListDataSourceProvider::processLazyLoadInternal(
     return connection->processLazyLoad(startIndex, items, correlationToken);
 }
 
+std::string
+DynamicIndexListDataSourceProvider::checkPayload(const Object& payload) const {
+    auto error = DynamicListDataSourceProvider::checkPayload(payload);
+    if (!error.empty())
+        return error;
+
+    auto minimumInclusiveIndex = payload.get(MINIMUM_INCLUSIVE_INDEX);
+    auto maximumExclusiveIndex = payload.get(MAXIMUM_EXCLUSIVE_INDEX);
+    if ((!minimumInclusiveIndex.isNull() && !minimumInclusiveIndex.isNumber()) ||
+        (!maximumExclusiveIndex.isNull() && !maximumExclusiveIndex.isNumber()))
+        return "Bounds are not numbers.";
+    if (minimumInclusiveIndex.isNumber() && maximumExclusiveIndex.isNumber() &&
+        minimumInclusiveIndex.getInteger() > maximumExclusiveIndex.getInteger())
+        return "Minimum index is above maximum index.";
+
+    if (payload.get(START_INDEX).isNumber()) {
+        auto items = payload.get(ITEMS);
+        if (!items.isArray() || items.empty())
+            return "No items provided to load.";
+        return "";
+    }
+
+    auto operations = payload.get(OPERATIONS);
+    if (!operations.isArray())
+        return "Payload missing required fields.";
+
+    for (const auto& operation : operations.getArray()) {
+        if (!operation.isMap() || !operation.get(UPDATE_TYPE).isString() || !operation.get(UPDATE_INDEX).isNumber())
+            return "Operation malformed.";
+
+        auto type = sDatasourceUpdateType.find(operation.get(UPDATE_TYPE).getString());
+        if (type == sDatasourceUpdateType.end())
+            return "Wrong update type.";
+
+        auto item = operation.get(UPDATE_ITEM);
+        auto items = item.isNull() ? operation.get(UPDATE_ITEMS) : item;
+        if ((type->second == kTypeInsert || type->second == kTypeReplace) && items.isNull())
+            return "Operation missing item.";
+        if (type->second == kTypeInsertMultiple && !items.isArray())
+            return "No array provided for range insert.";
+    }
+
+    return "";
+}
+
+/**
+ * @return true if an update operation can be applied together with the run that starts with first
+ *         and ends with last.
+ */
+static bool
+continuesRun(const DynamicIndexListUpdate& first, const DynamicIndexListUpdate& last,
+             const DynamicIndexListUpdate& update) {
+    auto isInsert = [](DynamicIndexListUpdateType type) {
+        return type == kTypeInsert || type == kTypeInsertMultiple;
+    };
+    auto isDelete = [](DynamicIndexListUpdateType type) {
+        return type == kTypeDelete || type == kTypeDeleteMultiple;
+    };
+
+    // Inserts relative to negative indexes are adjusted individually
+    if (update.index < 0 || first.index < 0)
+        return false;
+
+    if (isInsert(first.type) && isInsert(update.type)) {
+        if (last.type == kTypeInsertMultiple && !last.data.isArray())
+            return false;
+        auto inserted = last.type == kTypeInsert ? 1 : static_cast<int>(last.data.size());
+        return update.index == last.index + inserted;
+    }
+
+    if (isDelete(first.type) && isDelete(update.type))
+        return update.index == first.index;
+
+    if (first.type == kTypeReplace && update.type == kTypeReplace)
+        return update.index == last.index + 1;
+
+    return false;
+}
+
 bool
 DynamicIndexListDataSourceProvider::processUpdateInternal(
         const DILConnectionPtr& connection, const Object& responseMap) {
@@ -344,19 +556,43 @@ DynamicIndexListDataSourceProvider::processUpdateInternal(
     ObjectArray operations = responseMap.get(OPERATIONS).getArray();
     bool result = true;
 
+    // Operations on adjacent items are collected into runs and applied as one LiveArray change.
+    // A run that can't be applied as a whole falls back to one operation at a time, so partial
+    // application and error reporting are the same as without runs.
+    std::vector<DynamicIndexListUpdate> run;
+    auto flushRun = [&]() {
+        if (run.size() > 1 && connection->processUpdateRun(run)) {
+            run.clear();
+            return true;
+        }
+
+        for (const auto& update : run) {
+            if (!connection->processUpdate(update.type, update.index, update.data, update.count)) {
+                run.clear();
+                return false;
+            }
+        }
+        run.clear();
+        return true;
+    };
+
     for (const auto& operation : operations) {
         if (!operation.has(UPDATE_TYPE) || !operation.get(UPDATE_TYPE).isString() ||
             !operation.has(UPDATE_INDEX) || !operation.get(UPDATE_INDEX).isNumber()) {
-            constructAndReportError(connection->getContext(), ERROR_REASON_INVALID_OPERATION, connection,
-                                    Object::NULL_OBJECT(), "Operation malformed.");
+            result = flushRun();
+            if (result)
+                constructAndReportError(connection->getContext(), ERROR_REASON_INVALID_OPERATION, connection,
+                                        Object::NULL_OBJECT(), "Operation malformed.");
             result = false;
             break;
         }
 
         auto typeName = operation.get(UPDATE_TYPE).asString();
         if (!sDatasourceUpdateType.count(typeName)) {
-            constructAndReportError(connection->getContext(), ERROR_REASON_INVALID_OPERATION, connection,
-                                    Object::NULL_OBJECT(), "Wrong update type.");
+            result = flushRun();
+            if (result)
+                constructAndReportError(connection->getContext(), ERROR_REASON_INVALID_OPERATION, connection,
+                                        Object::NULL_OBJECT(), "Wrong update type.");
             result = false;
             break;
         }
@@ -366,12 +602,18 @@ DynamicIndexListDataSourceProvider::processUpdateInternal(
         auto item = operation.get(UPDATE_ITEM);
         auto items = item.isNull() ? operation.get(UPDATE_ITEMS) : item;
         auto count = operation.opt(COUNT, item.size()).asInt();
-        if (!connection->processUpdate(type, index, items, count)) {
+        DynamicIndexListUpdate update{type, index, items, count};
+
+        if (!run.empty() && !continuesRun(run.front(), run.back(), update) && !flushRun()) {
             result = false;
             break;
         }
+        run.emplace_back(std::move(update));
     }
 
+    if (result)
+        result = flushRun();
+
     if (!result) {
         connection->setFailed();
     }
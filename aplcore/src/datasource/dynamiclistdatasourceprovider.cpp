@@ -37,10 +37,85 @@ DynamicListDataSourceConnection::DynamicListDataSourceConnection(
     OffsetIndexDataSourceConnection(std::move(liveArray), offset, maxItems, configuration.cacheChunkSize),
     mContext(std::move(context)),
     mConfiguration(configuration),
+    mScheduler(configuration.cacheChunkSize, configuration.maxCacheChunkSize, configuration.maxPendingFetches),
     mListId(listId),
     mProvider(std::move(provider)),
     mListVersion(0) {}
 
+void
+DynamicListDataSourceConnection::ensure(size_t index) {
+    mScheduler.ensured(mOffset + index, currentTime());
+    trackEnsured(index);
+    OffsetIndexDataSourceConnection::ensure(index);
+}
+
+void
+DynamicListDataSourceConnection::trackEnsured(size_t index) {
+    if (mConfiguration.evictionDistance == 0)
+        return;
+
+    auto position = sourcePosition(index);
+    if (mEnsuredAny) {
+        mEnsuredLow = std::min(mEnsuredLow, position);
+        mEnsuredHigh = std::max(mEnsuredHigh, position);
+    } else {
+        mEnsuredAny = true;
+        mEnsuredLow = mEnsuredHigh = position;
+    }
+
+    auto context = mContext.lock();
+    if (mEvictionTimeout || !context)
+        return;
+
+    // Ensure is called during layout, while children still hold their old data indexes.  Defer
+    // dropping items until the layout pass is over.
+    std::weak_ptr<DynamicListDataSourceConnection> weak_ptr(shared_from_this());
+    mEvictionTimeout = context->getRootConfig().getTimeManager()->setTimeout([weak_ptr]() {
+      auto self = weak_ptr.lock();
+      if (self)
+          self->runEviction();
+    }, 0);
+}
+
+void
+DynamicListDataSourceConnection::runEviction() {
+    mEvictionTimeout = 0;
+    if (!mEnsuredAny)
+        return;
+    mEnsuredAny = false;
+
+    // A single pass may only report one end of the items on screen (a scroll reports the item it
+    // stopped at).  Keep everything the previous pass reported as well.
+    auto low = mEnsuredLow;
+    auto high = mEnsuredHigh;
+    if (mPreviousAny) {
+        low = std::min(low, mPreviousLow);
+        high = std::max(high, mPreviousHigh);
+    }
+    mPreviousAny = true;
+    mPreviousLow = mEnsuredLow;
+    mPreviousHigh = mEnsuredHigh;
+
+    // Never drop items the next fetch would ask for again
+    auto behind = std::max(mConfiguration.evictionDistance, prefetchWindow(false));
+    auto ahead = std::max(mConfiguration.evictionDistance, prefetchWindow(true));
+
+    auto evicted = evict(low - static_cast<std::ptrdiff_t>(behind), high + static_cast<std::ptrdiff_t>(ahead));
+    if (evicted == 0)
+        return;
+
+    mScheduler.evicted(evicted);
+    auto context = mContext.lock();
+    if (context)
+        context->setDirtyDataSourceContext(shared_from_this());
+}
+
+apl_time_t
+DynamicListDataSourceConnection::currentTime() const {
+    auto context = mContext.lock();
+    return context ? context->getRootConfig().getTimeManager()->currentTime() : 0;
+}
+
 void
 DynamicListDataSourceConnection::enqueueFetchRequestEvent(const ContextPtr& context, const ObjectMapPtr& request) {
     EventBag bag;
@@ -74,6 +149,7 @@ DynamicListDataSourceConnection::retryFetchRequest(const std::string& correlatio
     newToken = std::to_string(provider->getAndIncrementCorrelationToken());
     (*pendingRequest->request)[CORRELATION_TOKEN] = newToken;
     pendingRequest->relatedTokens.emplace_back(newToken);
+    mScheduler.retried(correlationToken, newToken, currentTime());
 
     enqueueFetchRequestEvent(context, pendingRequest->request);
 
@@ -83,6 +159,7 @@ DynamicListDataSourceConnection::retryFetchRequest(const std::string& correlatio
         mPendingFetchRequests.emplace(newToken, pendingRequest);
     } else {
         // Clean up all related
+        mScheduler.abandoned(newToken);
         for (auto& token : pendingRequest->relatedTokens) {
             mPendingFetchRequests.erase(token);
         }
@@ -119,19 +196,20 @@ DynamicListDataSourceConnection::clearTimeouts(const ContextPtr& context, const
     auto it = mPendingFetchRequests.find(correlationToken);
     if (it != mPendingFetchRequests.end()) {
         context->getRootConfig().getTimeManager()->clearTimeout(it->second->timeoutId);
+        mScheduler.completed(correlationToken, currentTime());
         for (auto& token : it->second->relatedTokens) {
             mPendingFetchRequests.erase(token);
         }
     }
 }
 
-void
+std::string
 DynamicListDataSourceConnection::sendFetchRequest(const ObjectMap& requestData) {
     auto context = mContext.lock();
     auto provider = mProvider.lock();
 
     if (!context || !provider)
-        return;
+        return "";
 
     for (const auto& request : mPendingFetchRequests) {
         auto requestMap = request.second->request;
@@ -147,7 +225,7 @@ DynamicListDataSourceConnection::sendFetchRequest(const ObjectMap& requestData)
 
         // If request such as that already in the go - ignore.
         if (allMatch)
-            return;
+            return "";
     }
 
     int requestToken = provider->getAndIncrementCorrelationToken();
@@ -167,6 +245,7 @@ DynamicListDataSourceConnection::sendFetchRequest(const ObjectMap& requestData)
     PendingFetchRequest pendingFetchRequest = {requestMap, mConfiguration.fetchRetries, timeoutId,
                                                {correlationToken}};
     mPendingFetchRequests.emplace(correlationToken, std::make_shared<PendingFetchRequest>(pendingFetchRequest));
+    return correlationToken;
 }
 
 timeout_id
@@ -334,6 +413,82 @@ DynamicListDataSourceProvider::processUpdate(const Object &payload) {
     return result;
 }
 
+/**
+ * Convert a JSON value into maps and arrays of objects, so that reading it later does not walk the
+ * JSON document.
+ */
+static Object
+materialize(const rapidjson::Value& value) {
+    if (value.IsObject()) {
+        auto map = std::make_shared<ObjectMap>();
+        for (const auto& member : value.GetObject())
+            map->emplace(std::string(member.name.GetString(), member.name.GetStringLength()),
+                         materialize(member.value));
+        return Object(map);
+    }
+
+    if (value.IsArray()) {
+        ObjectArray array;
+        array.reserve(value.Size());
+        for (const auto& item : value.GetArray())
+            array.emplace_back(materialize(item));
+        return Object(std::move(array));
+    }
+
+    return Object(value);
+}
+
+PreparedListUpdate
+DynamicListDataSourceProvider::prepareUpdate(const char *payload, size_t length) const {
+    PreparedListUpdate result;
+
+    rapidjson::Document doc;
+    rapidjson::ParseResult parseResult =
+            doc.Parse<rapidjson::kParseValidateEncodingFlag | rapidjson::kParseStopWhenDoneFlag>(payload, length);
+    if (parseResult.IsError()) {
+        result.mError = rapidjson::GetParseError_En(parseResult.Code());
+        return result;
+    }
+
+    result.mPayload = materialize(doc);
+    if (result.mPayload.isMap() && result.mPayload.get(LIST_ID).isString())
+        result.mListId = result.mPayload.get(LIST_ID).getString();
+    result.mError = checkPayload(result.mPayload);
+    return result;
+}
+
+bool
+DynamicListDataSourceProvider::processUpdate(const PreparedListUpdate& update) {
+    clearStaleConnections();
+
+    if (!update.parsed()) {
+        LOG(LogLevel::kError) << "Failed to parse update JSON: " << update.getError();
+        return false;
+    }
+
+    // A payload that failed the checks still goes through process() to report its errors
+    return process(update.mPayload);
+}
+
+std::string
+DynamicListDataSourceProvider::checkPayload(const Object& payload) const {
+    if (!payload.isMap())
+        return "Payload is not an object.";
+
+    if (!payload.get(LIST_ID).isString())
+        return "Missing listId.";
+
+    auto listVersion = payload.get(LIST_VERSION);
+    if (!listVersion.isNull() && !listVersion.isNumber())
+        return "listVersion is not a number.";
+
+    auto correlationToken = payload.get(CORRELATION_TOKEN);
+    if (!correlationToken.isNull() && !correlationToken.isString() && !correlationToken.isNumber())
+        return "correlationToken is not a string.";
+
+    return "";
+}
+
 void
 DynamicListDataSourceProvider::clearStaleConnections() {
     auto cIt = mConnections.cbegin();
@@ -399,6 +554,12 @@ DynamicListDataSourceProvider::getConnection(const std::string& listId, const Ob
     return connection;
 }
 
+FetchSchedulerStats
+DynamicListDataSourceProvider::getFetchStats(const std::string& listId) {
+    auto connection = getConnection(listId);
+    return connection ? connection->getFetchStats() : FetchSchedulerStats();
+}
+
 Object
 DynamicListDataSourceProvider::getPendingErrors() {
     Object result = Object(std::make_shared<ObjectArray>(mPendingErrors));
@@ -31,7 +31,8 @@ DynamicTokenListDataSourceConnection::DynamicTokenListDataSourceConnection(
     std::weak_ptr<LiveArray> liveArray,
     const std::string& listId,
     const Object& firstToken,
-    const Object& lastToken) :
+    const Object& lastToken,
+    const Object& pageToken) :
       DynamicListDataSourceConnection(
           std::move(context),
           listId,
@@ -41,7 +42,8 @@ DynamicTokenListDataSourceConnection::DynamicTokenListDataSourceConnection(
           0,
           SIZE_MAX),
       mFirstToken(firstToken),
-      mLastToken(lastToken) {}
+      mLastToken(lastToken),
+      mPageToken(pageToken) {}
 
 bool
 DynamicTokenListDataSourceConnection::processLazyLoad(
@@ -85,25 +87,89 @@ DynamicTokenListDataSourceConnection::updateLiveArray(
     size_t baseSize = liveArray->size();
     if (mMaxItems < baseSize || mMaxItems - baseSize < data.size()) return false;
 
+    if (mPages.empty())
+        mPages.push_back(Page{mPageToken, baseSize});
+
     auto pageTokenString = pageToken.asString();
     if (pageTokenString == mLastToken.asString()) {
         liveArray->insert(baseSize, data.begin(), data.end());
-        mLastToken = nextPageToken;
+        mPages.push_back(Page{mLastToken, data.size()});
+        mLastToken = restoreToken(mEvictedLast, pageToken, nextPageToken);
     }
 
     if (pageTokenString == mFirstToken.asString()) {
         liveArray->insert(0, data.begin(), data.end());
-        mFirstToken = nextPageToken;
+        mPages.push_front(Page{mFirstToken, data.size()});
+        mPrepended += data.size();
+        mFirstToken = restoreToken(mEvictedFirst, pageToken, nextPageToken);
     }
 
     return true;
 }
 
+Object
+DynamicTokenListDataSourceConnection::restoreToken(
+    std::vector<Evicted>& evicted,
+    const Object& pageToken,
+    const Object& nextPageToken) {
+    if (evicted.empty() || evicted.back().token.asString() != pageToken.asString())
+        return nextPageToken;
+
+    auto result = evicted.back().restore;
+    evicted.pop_back();
+    return result;
+}
+
+size_t
+DynamicTokenListDataSourceConnection::evict(std::ptrdiff_t first, std::ptrdiff_t last) {
+    LiveArrayPtr liveArray = mLiveArray.lock();
+    // A response to a pending request is matched against the current page tokens
+    if (!liveArray || hasPendingFetches())
+        return 0;
+
+    size_t evicted = 0;
+
+    // Drop whole pages after the last position, newest first
+    auto lastIndex = last + mPrepended;
+    while (mPages.size() > 1 && !mPages.back().token.isNull()) {
+        const auto& page = mPages.back();
+        auto start = liveArray->size() - page.size;
+        if (static_cast<std::ptrdiff_t>(start) <= lastIndex)
+            break;
+
+        liveArray->remove(start, page.size);
+        mEvictedLast.emplace_back(Evicted{page.token, mLastToken});
+        mLastToken = page.token;
+        evicted += page.size;
+        mPages.pop_back();
+    }
+
+    // Drop whole pages before the first position
+    auto firstIndex = first + mPrepended;
+    while (mPages.size() > 1 && !mPages.front().token.isNull()) {
+        const auto& page = mPages.front();
+        if (static_cast<std::ptrdiff_t>(page.size) > firstIndex)
+            break;
+
+        liveArray->remove(0, page.size);
+        mEvictedFirst.emplace_back(Evicted{page.token, mFirstToken});
+        mFirstToken = page.token;
+        mPrepended -= page.size;
+        firstIndex -= page.size;
+        evicted += page.size;
+        mPages.pop_front();
+    }
+
+    return evicted;
+}
+
 void
 DynamicTokenListDataSourceConnection::ensure(size_t index) {
     LiveArrayPtr liveArray = mLiveArray.lock();
     if (!liveArray) return;
 
+    trackEnsured(index);
+
     size_t baseSize = liveArray->size();
     if (baseSize >= mMaxItems) return;
 
@@ -143,9 +209,10 @@ DynamicTokenListDataSourceProvider::createConnection(
     auto backwardPageToken = sourceDefinition.get(BACKWARD_PAGE_TOKEN);
     auto forwardPageToken = sourceDefinition.get(FORWARD_PAGE_TOKEN);
 
+    // The initial items can be fetched again with the page token they were delivered for
     return std::make_shared<DynamicTokenListDataSourceConnection>(
         shared_from_this(), mConfiguration, context, liveArray, listId, backwardPageToken,
-        forwardPageToken);
+        forwardPageToken, sourceDefinition.get(PAGE_TOKEN));
 }
 
 bool
@@ -192,6 +259,26 @@ DynamicTokenListDataSourceProvider::process(const Object& responseMap) {
     return result;
 }
 
+std::string
+DynamicTokenListDataSourceProvider::checkPayload(const Object& payload) const {
+    auto error = DynamicListDataSourceProvider::checkPayload(payload);
+    if (!error.empty())
+        return error;
+
+    if (!payload.get(PAGE_TOKEN).isString())
+        return "Missing pageToken.";
+
+    auto nextPageToken = payload.get(NEXT_PAGE_TOKEN);
+    if (!nextPageToken.isNull() && !nextPageToken.isString())
+        return "nextPageToken is not a string.";
+
+    auto items = payload.get(ITEMS);
+    if (!items.isArray() || items.empty())
+        return "No items provided to load.";
+
+    return "";
+}
+
 void
 DynamicTokenListDataSourceConnection::serialize(rapidjson::Value& outMap,
                                                 rapidjson::Document::AllocatorType& allocator) {
@@ -0,0 +1,189 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "apl/datasource/fetchscheduler.h"
+
+namespace apl {
+
+// Weight of a new sample in the smoothed velocity and latency.
+static const double VELOCITY_SMOOTHING = 0.5;
+static const double LATENCY_SMOOTHING = 0.25;
+// Shortest interval a velocity sample is taken over.  A layout pass may run several times within
+// a display frame, and each pass reports slightly different items.
+static const apl_duration_t MINIMUM_SAMPLE_INTERVAL = 16;
+
+FetchScheduler::FetchScheduler(size_t minimumWindow, size_t maximumWindow, size_t maximumPending)
+    : mMinimumWindow(minimumWindow),
+      mMaximumWindow(std::max(minimumWindow, maximumWindow)),
+      mMaximumPending(maximumPending)
+{}
+
+void
+FetchScheduler::ensured(size_t index, apl_time_t now)
+{
+    auto position = static_cast<double>(index);
+
+    if (!mTracking) {
+        mTracking = true;
+        mAnchorIndex = mFrameLow = mFrameHigh = position;
+        mAnchorTime = mFrameTime = now;
+        return;
+    }
+
+    // Within a frame every item on screen is ensured.  Track the middle of them.
+    if (now <= mFrameTime) {
+        mFrameLow = std::min(mFrameLow, position);
+        mFrameHigh = std::max(mFrameHigh, position);
+        return;
+    }
+
+    auto middle = (mFrameLow + mFrameHigh) / 2;
+    if (mFrameTime == mAnchorTime) {
+        mAnchorIndex = middle;
+    } else if (mFrameTime - mAnchorTime >= MINIMUM_SAMPLE_INTERVAL) {
+        auto sample = (middle - mAnchorIndex) / (mFrameTime - mAnchorTime);
+        mStats.velocity += VELOCITY_SMOOTHING * (sample - mStats.velocity);
+        mAnchorIndex = middle;
+        mAnchorTime = mFrameTime;
+    }
+
+    mFrameLow = mFrameHigh = position;
+    mFrameTime = now;
+}
+
+size_t
+FetchScheduler::window(bool forward) const
+{
+    auto speed = forward ? mStats.velocity : -mStats.velocity;
+    if (speed <= 0 || mMaximumWindow == mMinimumWindow)
+        return mMinimumWindow;
+
+    auto extra = std::ceil(speed * mStats.latency);
+    if (extra >= static_cast<double>(mMaximumWindow - mMinimumWindow))
+        return mMaximumWindow;
+    return mMinimumWindow + static_cast<size_t>(extra);
+}
+
+bool
+FetchScheduler::admit(size_t& index, size_t& count)
+{
+    mStats.requested++;
+
+    auto trimmed = false;
+    for (const auto& flight : mInFlight) {
+        auto end = index + count;
+        auto flightEnd = flight.index + flight.count;
+        if (flightEnd <= index || flight.index >= end)
+            continue;
+
+        if (flight.index <= index && flightEnd >= end) {
+            mStats.coalesced++;
+            return false;
+        }
+
+        // Drop the part that is already on its way.  A flight in the middle of the range is left
+        // alone; splitting the request would leave a gap.
+        if (flight.index <= index) {
+            count = end - flightEnd;
+            index = flightEnd;
+            trimmed = true;
+        } else if (flightEnd >= end) {
+            count = flight.index - index;
+            trimmed = true;
+        }
+    }
+
+    if (trimmed)
+        mStats.coalesced++;
+
+    if (mMaximumPending > 0 && mInFlight.size() >= mMaximumPending) {
+        mStats.throttled++;
+        return false;
+    }
+
+    return true;
+}
+
+void
+FetchScheduler::issued(const std::string& token, size_t index, size_t count, apl_time_t now)
+{
+    mStats.issued++;
+    mInFlight.emplace_back(InFlight{index, count, now, {token}});
+}
+
+void
+FetchScheduler::retried(const std::string& token, const std::string& newToken, apl_time_t now)
+{
+    auto it = find(token);
+    if (it == mInFlight.end())
+        return;
+
+    it->tokens.emplace_back(newToken);
+    it->sent = now;
+}
+
+void
+FetchScheduler::completed(const std::string& token, apl_time_t now)
+{
+    auto it = find(token);
+    if (it == mInFlight.end())
+        return;
+
+    auto sample = std::max(0.0, now - it->sent);
+    if (mStats.completed == 0)
+        mStats.latency = sample;
+    else
+        mStats.latency += LATENCY_SMOOTHING * (sample - mStats.latency);
+
+    mStats.completed++;
+    mInFlight.erase(it);
+}
+
+void
+FetchScheduler::abandoned(const std::string& token)
+{
+    auto it = find(token);
+    if (it != mInFlight.end())
+        mInFlight.erase(it);
+}
+
+void
+FetchScheduler::forgetRanges()
+{
+    for (auto& flight : mInFlight)
+        flight.count = 0;
+}
+
+bool
+FetchScheduler::hasPendingIn(size_t begin, size_t end) const
+{
+    // A request whose range was forgotten may deliver anything
+    return std::any_of(mInFlight.begin(), mInFlight.end(), [&](const InFlight& flight) {
+        return flight.count == 0 || (flight.index < end && flight.index + flight.count > begin);
+    });
+}
+
+std::vector<FetchScheduler::InFlight>::iterator
+FetchScheduler::find(const std::string& token)
+{
+    return std::find_if(mInFlight.begin(), mInFlight.end(), [&](const InFlight& flight) {
+        return std::find(flight.tokens.begin(), flight.tokens.end(), token) != flight.tokens.end();
+    });
+}
+
+} // namespace apl
@@ -177,17 +177,19 @@ OffsetIndexDataSourceConnection::ensure(size_t index) {
 
     size_t baseSize = liveArray->size();
 
-    if (baseSize < mMaxItems && (int)index + mCacheChunkSize > baseSize) {
+    auto ahead = prefetchWindow(true);
+    if (baseSize < mMaxItems && index + ahead > baseSize) {
         size_t dsOffset = mOffset + baseSize;
-        size_t toCache = std::min(mMaxItems - dsOffset, (size_t)mCacheChunkSize);
+        size_t toCache = std::min(mMaxItems - dsOffset, ahead);
 
         if (toCache != 0) {
             fetch(dsOffset, toCache);
         }
     }
 
-    if (baseSize && mOffset > 0 && (int)index - mCacheChunkSize < 0) {
-        size_t dsOffset = mOffset > mCacheChunkSize ? mOffset - mCacheChunkSize : 0;
+    auto behind = prefetchWindow(false);
+    if (baseSize && mOffset > 0 && index < behind) {
+        size_t dsOffset = mOffset > behind ? mOffset - behind : 0;
         size_t toCache = mOffset - dsOffset;
 
         if (toCache != 0) {
@@ -380,7 +380,30 @@ rapidjson::Value
 CoreDocumentContext::serializeVisualContext(rapidjson::Document::AllocatorType& allocator)
 {
     clearVisualContextDirty();
-    return mCore->mTop->serializeVisualContext(allocator);
+    auto visualContext = mCore->mTop->serializeVisualContext(allocator);
+    if (mVisualContextSnapshot)
+        mVisualContextSnapshot = VisualContextSnapshot::create(visualContext);
+    return visualContext;
+}
+
+void
+CoreDocumentContext::serializeVisualContext(JsonSink& sink)
+{
+    // Visual context fragments are already cached per subtree, so build once and replay
+    rapidjson::Document scratch;
+    serializeVisualContext(scratch.GetAllocator()).Accept(sink);
+}
+
+rapidjson::Value
+CoreDocumentContext::serializeVisualContextDelta(rapidjson::Document::AllocatorType& allocator)
+{
+    clearVisualContextDirty();
+    rapidjson::Document visualContext;
+    auto snapshot = VisualContextSnapshot::create(
+        mCore->mTop->serializeVisualContext(visualContext.GetAllocator()));
+    auto delta = snapshot->diff(mVisualContextSnapshot.get(), allocator);
+    mVisualContextSnapshot = std::move(snapshot);
+    return delta;
 }
 
 bool
@@ -415,6 +438,24 @@ CoreDocumentContext::serializeDataSourceContext(rapidjson::Document::AllocatorTy
     return outArray;
 }
 
+void
+CoreDocumentContext::serializeDataSourceContext(JsonSink& sink)
+{
+    clearDataSourceContextDirty();
+
+    rapidjson::SizeType count = 0;
+    sink.StartArray();
+    for (const auto& tracker : mCore->dataManager().trackers()) {
+        if (auto sourceConnection = tracker->getDataSourceConnection()) {
+            rapidjson::Document datasource(rapidjson::kObjectType);
+            sourceConnection->serialize(datasource, datasource.GetAllocator());
+            datasource.Accept(sink);
+            count++;
+        }
+    }
+    sink.EndArray(count);
+}
+
 rapidjson::Value
 CoreDocumentContext::serializeDOM(bool extended, rapidjson::Document::AllocatorType& allocator)
 {
@@ -423,6 +464,15 @@ CoreDocumentContext::serializeDOM(bool extended, rapidjson::Document::AllocatorT
     return mCore->mTop->serialize(allocator);
 }
 
+void
+CoreDocumentContext::serializeDOM(bool extended, JsonSink& sink)
+{
+    if (extended)
+        mCore->mTop->serializeAll(sink);
+    else
+        mCore->mTop->serialize(sink);
+}
+
 rapidjson::Value
 CoreDocumentContext::serializeContext(rapidjson::Document::AllocatorType& allocator)
 {
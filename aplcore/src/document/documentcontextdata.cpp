@@ -59,7 +59,12 @@ DocumentContextData::DocumentContextData(
       mExtensionManager(new ExtensionManager(extensions, config, session)),
       mUniqueIdManager(new UIDManager(sharedContext->uidGenerator(), session)),
       mSession(session)
-{}
+{
+    auto expressionCacheLimit = config.getProperty(RootProperty::kExpressionCacheLimit).getInteger();
+    if (expressionCacheLimit > 0)
+        mExpressionCache = std::make_unique<LruCache<std::string, std::shared_ptr<datagrammar::ByteCodeTemplate>>>(
+            expressionCacheLimit);
+}
 
 DocumentContextData::~DocumentContextData() {
     mSharedData.reset();
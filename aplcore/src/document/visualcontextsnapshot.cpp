@@ -0,0 +1,101 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "apl/document/visualcontextsnapshot.h"
+
+namespace apl {
+
+VisualContextSnapshotPtr
+VisualContextSnapshot::create(const rapidjson::Value& visualContext)
+{
+    auto snapshot = VisualContextSnapshotPtr(new VisualContextSnapshot());
+    snapshot->mDocument.SetArray();
+    if (visualContext.IsObject()) {
+        auto uid = visualContext.FindMember("uid");
+        if (uid != visualContext.MemberEnd() && uid->value.IsString())
+            snapshot->mRoot = uid->value.GetString();
+        snapshot->flatten(visualContext);
+    }
+
+    // Entries are only indexed once the backing array stops growing
+    for (const auto& entry : snapshot->mDocument.GetArray())
+        snapshot->mEntries.emplace(entry["uid"].GetString(), &entry);
+
+    return snapshot;
+}
+
+void
+VisualContextSnapshot::flatten(const rapidjson::Value& entry)
+{
+    auto& allocator = mDocument.GetAllocator();
+    auto uid = entry.FindMember("uid");
+    if (uid == entry.MemberEnd() || !uid->value.IsString())
+        return;
+
+    rapidjson::Value flat(rapidjson::kObjectType);
+    for (const auto& member : entry.GetObject()) {
+        if (member.name == "children") {
+            rapidjson::Value childIds(rapidjson::kArrayType);
+            for (const auto& child : member.value.GetArray()) {
+                auto childUid = child.FindMember("uid");
+                if (childUid != child.MemberEnd())
+                    childIds.PushBack(rapidjson::Value(childUid->value, allocator), allocator);
+            }
+            flat.AddMember(rapidjson::Value(member.name, allocator), childIds, allocator);
+        } else {
+            flat.AddMember(rapidjson::Value(member.name, allocator),
+                           rapidjson::Value(member.value, allocator), allocator);
+        }
+    }
+    mDocument.PushBack(flat, allocator);
+
+    auto children = entry.FindMember("children");
+    if (children != entry.MemberEnd() && children->value.IsArray()) {
+        for (const auto& child : children->value.GetArray())
+            flatten(child);
+    }
+}
+
+rapidjson::Value
+VisualContextSnapshot::diff(const VisualContextSnapshot* previous,
+                            rapidjson::Document::AllocatorType& allocator) const
+{
+    rapidjson::Value updated(rapidjson::kArrayType);
+    rapidjson::Value removed(rapidjson::kArrayType);
+
+    for (const auto& entry : mEntries) {
+        if (previous) {
+            auto it = previous->mEntries.find(entry.first);
+            if (it != previous->mEntries.end() && *it->second == *entry.second)
+                continue;
+        }
+        updated.PushBack(rapidjson::Value(*entry.second, allocator), allocator);
+    }
+
+    if (previous) {
+        for (const auto& entry : previous->mEntries) {
+            if (mEntries.find(entry.first) == mEntries.end())
+                removed.PushBack(rapidjson::Value(entry.first.c_str(), allocator), allocator);
+        }
+    }
+
+    rapidjson::Value delta(rapidjson::kObjectType);
+    delta.AddMember("root", rapidjson::Value(mRoot.c_str(), allocator), allocator);
+    delta.AddMember("updated", updated, allocator);
+    delta.AddMember("removed", removed, allocator);
+    return delta;
+}
+
+} // namespace apl
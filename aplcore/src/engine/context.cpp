@@ -524,6 +524,14 @@ Context::cachedBaselines()
     return documentContextData(mCore)->cachedBaselines();
 }
 
+ExpressionCache*
+Context::expressionCache() const
+{
+    if (!mCore->fullContext())
+        return nullptr;
+    return documentContextData(mCore)->expressionCache();
+}
+
 WeakPtrSet<CoreComponent>&
 Context::pendingOnMounts()
 {
@@ -257,6 +257,20 @@ CoreRootContext::serializeVisualContext(rapidjson::Document::AllocatorType& allo
     return mTopDocument->serializeVisualContext(allocator);
 }
 
+void
+CoreRootContext::serializeVisualContext(JsonSink& sink)
+{
+    clearVisualContextDirty();
+    mTopDocument->serializeVisualContext(sink);
+}
+
+rapidjson::Value
+CoreRootContext::serializeVisualContextDelta(rapidjson::Document::AllocatorType& allocator)
+{
+    clearVisualContextDirty();
+    return mTopDocument->serializeVisualContextDelta(allocator);
+}
+
 bool
 CoreRootContext::isDataSourceContextDirty() const
 {
@@ -278,6 +292,13 @@ CoreRootContext::serializeDataSourceContext(rapidjson::Document::AllocatorType&
     return mTopDocument->serializeDataSourceContext(allocator);
 }
 
+void
+CoreRootContext::serializeDataSourceContext(JsonSink& sink)
+{
+    assert(mTopDocument);
+    mTopDocument->serializeDataSourceContext(sink);
+}
+
 rapidjson::Value
 CoreRootContext::serializeDOM(bool extended, rapidjson::Document::AllocatorType& allocator)
 {
@@ -285,6 +306,13 @@ CoreRootContext::serializeDOM(bool extended, rapidjson::Document::AllocatorType&
     return mTopDocument->serializeDOM(extended, allocator);
 }
 
+void
+CoreRootContext::serializeDOM(bool extended, JsonSink& sink)
+{
+    assert(mTopDocument);
+    mTopDocument->serializeDOM(extended, sink);
+}
+
 rapidjson::Value
 CoreRootContext::serializeContext(rapidjson::Document::AllocatorType& allocator)
 {
@@ -523,6 +551,13 @@ CoreRootContext::handlePointerEvent(const PointerEvent& pointerEvent)
     return mShared->pointerManager().handlePointerEvent(pointerEvent, mTimeManager->currentTime());
 }
 
+bool
+CoreRootContext::handlePointerEvents(const std::vector<PointerSample>& samples)
+{
+    assert(mShared);
+    return mShared->pointerManager().handlePointerEvents(samples);
+}
+
 const RootConfig&
 CoreRootContext::getRootConfig() const
 {
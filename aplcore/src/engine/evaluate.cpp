@@ -136,18 +136,65 @@ evaluate(const Context& context, const char *expression)
     return evaluate(context, Object(expression));
 }
 
+/**
+ * Same result as applyDataBindingNested(parseDataBindingNested(object)), in a single pass that does not
+ * build a parsed copy of the maps and arrays.  Extension messages and live data are evaluated this way.
+ */
+static Object
+parseAndApplyNested(const Context& context, // NOLINT(misc-no-recursion)
+                    const Object& object,
+                    BoundSymbolSet *symbols,
+                    int depth)
+{
+    if (object.isString())
+        return applyDataBindingNested(context, parseDataBinding(context, object.getString(), false), symbols, depth);
+
+    if (object.isTrueMap()) {
+        auto result = std::make_shared<std::map<std::string, Object>>();
+        for (const auto& m : object.getMap())
+            result->emplace(m.first, parseAndApplyNested(context, m.second, symbols, depth));
+        return { result };
+    }
+
+    if (object.isArray()) {  // Embedded data-bound strings are inserted in-line: E.g., [ 1, "${b}" ]
+        std::vector<Object> v;
+        v.reserve(object.size());
+        for (auto index = 0 ; index < object.size() ; index++) {
+            auto item = object.at(index);
+            Object itemEvaluated;
+            bool isByteCode;
+            if (item.isString()) {
+                auto parsed = parseDataBinding(context, item.getString(), false);
+                itemEvaluated = applyDataBindingNested(context, parsed, symbols, depth);
+                isByteCode = parsed.is<datagrammar::ByteCode>();
+            } else {
+                itemEvaluated = parseAndApplyNested(context, item, symbols, depth);
+                isByteCode = item.is<datagrammar::ByteCode>();
+            }
+
+            if (isByteCode && itemEvaluated.isArray()) {  // Insert the results into the array
+                for (const auto& n : itemEvaluated.getArray())
+                    v.push_back(n);
+            } else {
+                v.push_back(itemEvaluated);
+            }
+        }
+        return { std::move(v) };
+    }
+
+    return applyDataBindingNested(context, object, symbols, depth);
+}
+
 Object
 evaluateNested(const Context& context, const Object& object, BoundSymbolSet *symbolSet)
 {
-    auto result = parseDataBindingNested(context, object, false);
-    return applyDataBindingNested(context, result, symbolSet, 0);
+    return parseAndApplyNested(context, object, symbolSet, 0);
 }
 
 Object
 evaluateInternal(const Context& context, const Object& object, BoundSymbolSet *symbolSet, int depth)
 {
-    auto result = parseDataBindingNested(context, object, false);
-    return applyDataBindingNested(context, result, symbolSet, depth);
+    return parseAndApplyNested(context, object, symbolSet, depth);
 }
 
 ParseResult
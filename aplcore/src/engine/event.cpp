@@ -153,6 +153,35 @@ Event::serialize(rapidjson::Document::AllocatorType& allocator) const
     return event;
 }
 
+void
+Event::serialize(JsonSink& sink) const
+{
+    rapidjson::SizeType memberCount = 0;
+    sink.StartObject();
+
+    sink.Key("type", 4, false);
+    sink.Int(mData->eventType);
+    memberCount++;
+
+    if (mData->component != nullptr) {
+        sink.Key("id", 2, false);
+        sink.String(mData->component->getUniqueId());
+        memberCount++;
+    }
+
+    for (auto& m : mData->bag) {
+        if (!sEventPropertyBimap.has(m.first)) {
+            LOG(LogLevel::kError).session(getComponent()) << "Unknown property enum: " << m.first;
+            continue;
+        }
+        rapidjson::Document scratch;
+        sink.Member(sEventPropertyBimap.at(m.first), m.second.serialize(scratch.GetAllocator()));
+        memberCount++;
+    }
+
+    sink.EndObject(memberCount);
+}
+
 bool
 Event::operator==(const Event& other) const
 {
@@ -103,7 +103,9 @@ ExtensionClient::create(const RootConfigPtr& rootConfig, const std::string& uri,
 ExtensionClient::ExtensionClient(const std::string& uri, const SessionPtr& session, const Object& flags)
     :  mRegistrationProcessed(false), mRegistered(false), mUri(uri), mSession(session), mFlags(flags),
        mInternalRootConfig(RootConfig::create())
-{}
+{
+    compileSchema();
+}
 
 rapidjson::Value
 ExtensionClient::createRegistrationRequest(rapidjson::Document::AllocatorType& allocator, Content& content) {
@@ -298,14 +300,42 @@ ExtensionClient::processRegistrationResponse(const Context& context, const Objec
     }
 
     mRegistered = true;
+    compileSchema();
     return true;
 }
 
+/**
+ * Build the lookup tables and the command envelope used for each message from the schema and the
+ * connection token.  Called again once the extension has registered.
+ */
+void
+ExtensionClient::compileSchema()
+{
+    mFastModeEvents.clear();
+    for (const auto& m : mSchema.eventModes)
+        mFastModeEvents.emplace(m.first, m.second == kExtensionEventExecutionModeFast);
+
+    mLiveDataIndex.clear();
+    for (auto& m : mLiveData)
+        mLiveDataIndex.emplace(m.first, &m.second);
+
+    // Commands only differ by id, name, payload and resource
+    auto& allocator = mCommandEnvelope.GetAllocator();
+    mCommandEnvelope.SetObject();
+    mCommandEnvelope.AddMember("version", rapidjson::StringRef(IMPLEMENTED_INTERFACE_VERSION.c_str()), allocator);
+    mCommandEnvelope.AddMember("method",
+                               rapidjson::StringRef(sExtensionMethodBimap.at(kExtensionMethodCommand).c_str()),
+                               allocator);
+    mCommandEnvelope.AddMember("token", rapidjson::Value(mConnectionToken.c_str(), allocator), allocator);
+    mCommandEnvelope.AddMember("target", rapidjson::Value(mUri.c_str(), allocator), allocator);
+}
+
 bool
 ExtensionClient::processEvent(const Context& context, const Object& event)
 {
     auto name = propertyAsObject(context, event, "name");
-    if (!name.isString() || name.empty() || (mSchema.eventModes.find(name.getString()) == mSchema.eventModes.end())) {
+    auto mode = name.isString() ? mFastModeEvents.find(name.getString()) : mFastModeEvents.end();
+    if (mode == mFastModeEvents.end() || name.empty()) {
         CONSOLE(mSession) << "Invalid extension event name for extension=" << mUri
                 << " name:" << name.toDebugString();
         return false;
@@ -327,7 +357,7 @@ ExtensionClient::processEvent(const Context& context, const Object& event)
     invokeExtensionHandler(mUri,
                            name.getString(),
                            payload.isNull() ? Object::EMPTY_MAP().getMap() : payload.getMap(),
-                           mSchema.eventModes.at(name.getString()) == kExtensionEventExecutionModeFast,
+                           mode->second,
                            resourceId);
     return true;
 }
@@ -359,15 +389,13 @@ ExtensionClient::processCommand(rapidjson::Document::AllocatorType& allocator, c
         return rapidjson::Value (rapidjson::kNullType);
     }
 
-    auto result = std::make_shared<ObjectMap>();
-    result->emplace("version", IMPLEMENTED_INTERFACE_VERSION);
-    result->emplace("method", sExtensionMethodBimap.at(kExtensionMethodCommand));
-    result->emplace("token", mConnectionToken);
+    // Deep copy, the message may outlive this client
+    rapidjson::Value result(mCommandEnvelope, allocator);
     if (!resourceId.empty()) {
-        result->emplace("resourceId", resourceId);
+        result.AddMember("resourceId", rapidjson::Value(resourceId.getString().c_str(), allocator), allocator);
     }
     auto id = sCommandIdGenerator++;
-    result->emplace("id", id  );
+    result.AddMember("id", static_cast<double>(id), allocator);
 
     auto actionRef = event.getActionRef();
     if (!actionRef.empty() && actionRef.isPending()) {
@@ -381,11 +409,10 @@ ExtensionClient::processCommand(rapidjson::Document::AllocatorType& allocator, c
     }
 
     auto parameters = event.getValue(kEventPropertyExtension);
-    result->emplace("name", commandName.getString());
-    result->emplace("target", extensionURI.getString());
-    result->emplace("payload", parameters);
+    result.AddMember("name", rapidjson::Value(commandName.getString().c_str(), allocator), allocator);
+    result.AddMember("payload", parameters.serialize(allocator), allocator);
 
-    return Object(result).serialize(allocator);
+    return result;
 }
 
 bool
@@ -552,7 +579,8 @@ bool
 ExtensionClient::processLiveDataUpdate(const Context& context, const Object& update)
 {
     auto name = propertyAsObject(context, update, "name");
-    if (!name.isString() || name.empty() || (mLiveData.find(name.getString()) == mLiveData.end())) {
+    auto ref = name.isString() ? mLiveDataIndex.find(name.getString()) : mLiveDataIndex.end();
+    if (ref == mLiveDataIndex.end() || name.empty()) {
         CONSOLE(mSession) << "Invalid LiveData name for extension=" << mUri;
         return false;
     }
@@ -569,7 +597,7 @@ ExtensionClient::processLiveDataUpdate(const Context& context, const Object& upd
         return false;
     }
 
-    auto& dataRef = mLiveData.at(name.getString());
+    auto& dataRef = *ref->second;
     for (const auto& operation : operations.getArray()) {
         auto type = propertyAsMapped<ExtensionLiveDataUpdateType>(context, operation, "type",
                 static_cast<ExtensionLiveDataUpdateType>(-1), sExtensionLiveDataUpdateTypeBimap);
@@ -870,14 +870,21 @@ ExtensionMediator::enqueueResponse(const alexaext::ActivityDescriptorPtr& activi
 {
     if (!activity) return;
 
+    // The message is only valid for the duration of the callback that delivered it.  When it is
+    // processed before the callback returns it is read in place, otherwise it is copied once and
+    // the copy is handed over to the task.
+    if (mMessageExecutor->isSynchronous()) {
+        processMessage(activity, JsonData(message));
+        return;
+    }
+
     const auto& uri = activity->getURI();
     std::weak_ptr<ExtensionMediator> weak_this = shared_from_this();
-    // TODO optimize
     auto copy = std::make_shared<rapidjson::Document>();
     copy->CopyFrom(message, copy->GetAllocator());
     bool enqueued = mMessageExecutor->enqueueTask([weak_this, activity, copy] () {
         if (auto mediator = weak_this.lock()) {
-            mediator->processMessage(activity, *copy);
+            mediator->processMessage(activity, JsonData(std::move(*copy)));
         }
     });
     if (!enqueued)
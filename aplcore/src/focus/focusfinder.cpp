@@ -15,6 +15,10 @@
 
 #include "apl/focus/focusfinder.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 #include "apl/component/corecomponent.h"
 #include "apl/document/documentcontextdata.h"
 #include "apl/focus/beamintersect.h"
@@ -24,6 +28,34 @@ namespace apl {
 
 const bool DEBUG_FOCUS_FINDER = false;
 
+// Number of search roots whose focusable components are kept
+static const size_t FOCUSABLE_CACHE_SIZE = 8;
+
+/**
+ * @return The edge of a rectangle that the distance in a direction is measured from.
+ */
+static float
+leadingEdge(const Rect& rect, FocusDirection direction)
+{
+    switch (direction) {
+        case kFocusDirectionLeft: return rect.getRight();
+        case kFocusDirectionRight: return rect.getLeft();
+        case kFocusDirectionUp: return rect.getBottom();
+        default: return rect.getTop();
+    }
+}
+
+static size_t
+edgeIndex(FocusDirection direction)
+{
+    switch (direction) {
+        case kFocusDirectionLeft: return 1;
+        case kFocusDirectionRight: return 0;
+        case kFocusDirectionUp: return 3;
+        default: return 2;
+    }
+}
+
 std::vector<CoreComponentPtr>
 FocusFinder::getFocusables(const CoreComponentPtr& root, bool ignoreVisitorPruning)
 {
@@ -90,27 +122,101 @@ FocusFinder::findNext(
     return nullptr;
 }
 
+FocusFinder::FocusableSet&
+FocusFinder::focusableSet(const CoreComponentPtr& root)
+{
+    for (auto it = mCache.begin() ; it != mCache.end() ; it++) {
+        if (it->root.lock() == root) {
+            std::rotate(it, it + 1, mCache.end());
+            return mCache.back();
+        }
+    }
+
+    if (mCache.size() >= FOCUSABLE_CACHE_SIZE)
+        mCache.erase(mCache.begin());
+
+    mCache.emplace_back();
+    auto& set = mCache.back();
+    set.root = root;
+    for (const auto& focusable : getFocusables(root, false)) {
+        Rect bounds;
+        focusable->getBoundsInParent(root, bounds);
+        // Components without an area are never valid candidates
+        if (bounds.empty() || !std::isfinite(bounds.getLeft()) || !std::isfinite(bounds.getTop()) ||
+            !std::isfinite(bounds.getRight()) || !std::isfinite(bounds.getBottom()))
+            continue;
+        set.entries.emplace_back(FocusableSet::Entry{focusable, bounds});
+    }
+    return set;
+}
+
+const std::vector<size_t>&
+FocusFinder::sortedFor(FocusableSet& set, FocusDirection direction)
+{
+    auto& order = set.order[edgeIndex(direction)];
+    if (order.size() != set.entries.size()) {
+        order.resize(set.entries.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return leadingEdge(set.entries.at(a).bounds, direction) < leadingEdge(set.entries.at(b).bounds, direction);
+        });
+    }
+    return order;
+}
+
 CoreComponentPtr
 FocusFinder::findNextInternal(const CoreComponentPtr& root, const Rect& focusedRect, FocusDirection direction)
 {
     LOG_IF(DEBUG_FOCUS_FINDER).session(root) << "Root:" << root->toDebugSimpleString() << " focusedRect:" <<
         focusedRect.toDebugString() << " direction:" << direction;
-    auto focusables = getFocusables(root, false);
+
+    if (direction != kFocusDirectionLeft && direction != kFocusDirectionRight &&
+        direction != kFocusDirectionUp && direction != kFocusDirectionDown)
+        return nullptr;
+
     CoreComponentPtr bestCandidate;
     // TODO: Really simple Android-like BeamIntersect scorer. Likely needs tweaking.
     BeamIntersect bestIntersect;
-
-    for (auto& focusable : focusables) {
-        Rect candidateRect;
-        focusable->getBoundsInParent(root, candidateRect);
-        if (isValidCandidate(root, focusedRect, focusable, candidateRect, direction)) {
-            auto candidateIntersect = BeamIntersect::build(focusedRect, candidateRect, direction);
-            LOG_IF(DEBUG_FOCUS_FINDER).session(root) << "Candidate: " << focusable->toDebugSimpleString()
-                                       << " intersect: " << candidateIntersect;
-            if (bestIntersect.empty() || candidateIntersect > bestIntersect) {
-                bestIntersect = candidateIntersect;
-                bestCandidate = focusable;
-            }
+    size_t bestIndex = 0;
+
+    auto& set = focusableSet(root);
+    const auto& sorted = sortedFor(set, direction);
+    auto forward = direction == kFocusDirectionRight || direction == kFocusDirectionDown;
+    auto originEdge = leadingEdge(focusedRect, direction);
+
+    // Only the candidates on the far side of the origin are valid.  They are visited closest first,
+    // and the search stops once the gap alone is larger than the distance to the best candidate
+    // that intersects the beam: nothing further away can beat it.
+    auto compareEdge = [&](size_t index, float value) {
+        return leadingEdge(set.entries.at(index).bounds, direction) < value;
+    };
+    auto first = std::lower_bound(sorted.begin(), sorted.end(), originEdge, compareEdge) - sorted.begin();
+    auto last = std::upper_bound(sorted.begin(), sorted.end(), originEdge, [&](float value, size_t index) {
+        return value < leadingEdge(set.entries.at(index).bounds, direction);
+    }) - sorted.begin();
+
+    auto count = forward ? sorted.size() - last : first;
+    for (size_t i = 0 ; i < count ; i++) {
+        auto index = forward ? sorted.at(last + i) : sorted.at(first - 1 - i);
+        const auto& entry = set.entries.at(index);
+
+        auto gap = std::abs(leadingEdge(entry.bounds, direction) - originEdge);
+        if (!bestIntersect.empty() && bestIntersect.getIntersect() > 0 && gap * gap > bestIntersect.getDistance())
+            break;
+
+        auto focusable = entry.component.lock();
+        if (!focusable || !isValidCandidate(root, focusedRect, focusable, entry.bounds, direction))
+            continue;
+
+        auto candidateIntersect = BeamIntersect::build(focusedRect, entry.bounds, direction);
+        LOG_IF(DEBUG_FOCUS_FINDER).session(root) << "Candidate: " << focusable->toDebugSimpleString()
+                                   << " intersect: " << candidateIntersect;
+        // Equally good candidates are resolved in favor of the first one in the hierarchy
+        if (bestIntersect.empty() || candidateIntersect > bestIntersect ||
+            (!(bestIntersect > candidateIntersect) && index < bestIndex)) {
+            bestIntersect = candidateIntersect;
+            bestCandidate = focusable;
+            bestIndex = index;
         }
     }
 
@@ -334,9 +334,17 @@ FocusManager::getFocusableAreas()
     return result;
 }
 
+void
+FocusManager::invalidateFocusables()
+{
+    if (mFinder)
+        mFinder->clearCache();
+}
+
 void FocusManager::terminate()
 {
     mTerminated = true;
+    invalidateFocusables();
     mCore.sequencer().terminateSequencer(FOCUS_RELEASE_SEQUENCER);
     mCore.sequencer().terminateSequencer(FOCUS_SEQUENCER);
 }
@@ -118,12 +118,20 @@ GraphicBuilder::addChildren(GraphicElement& element, const Object& json)
     const auto length = items.size();
     for (size_t i = 0; i < length; i++) {
         const auto& item = items.at(i);
-        auto childContext = Context::createFromParent(element.mContext);
+        const auto candidates = arrayify(context, item);
+        ContextPtr childContext;
         if (mMultichildSupport) {
+            childContext = Context::createFromParent(element.mContext);
             childContext->putConstant("index", index);
             childContext->putConstant("length", length);
         }
-        auto child = createChildFromArray(childContext, arrayify(context, item));
+        else {
+            // Older graphics don't define "index" or "length", so a child only needs its own
+            // context when it has bindings.  Static children share the context of their parent.
+            childContext = needsContext(candidates) ? Context::createFromParent(element.mContext)
+                                                    : element.mContext;
+        }
+        auto child = createChildFromArray(childContext, candidates);
         if (child) {
             LOG_IF(DEBUG_GRAPHIC_BUILDER).session(context) << "child [" << i << "]";
             element.mChildren.push_back(child);
@@ -146,11 +154,11 @@ GraphicBuilder::createChild(const ContextPtr& context, const Object& json)
         return nullptr;
     }
 
-    // Create a new context and apply data binding
-    ContextPtr expanded = Context::createFromParent(context);
+    // Apply data binding.  The caller has already created a context for this child, so the
+    // bindings are stored directly in it rather than in an additional empty context.
     auto bindings = arrayifyProperty(*context, json, "bind");
     for (const auto& binding : bindings) {
-        auto name = propertyAsString(*expanded, binding, "name");
+        auto name = propertyAsString(*context, binding, "name");
         if (!isValidIdentifier(name)) {
             CONSOLE(context) << "Invalid binding name '" << name << "'";
             continue;
@@ -164,7 +172,7 @@ GraphicBuilder::createChild(const ContextPtr& context, const Object& json)
         // Extract the binding as an optional node tree.
         auto result = parseAndEvaluate(*context, binding.get("value"));
         auto bindingType =
-            propertyAsMapped<BindingType>(*expanded, binding, "type", kBindingTypeAny, sBindingMap);
+            propertyAsMapped<BindingType>(*context, binding, "type", kBindingTypeAny, sBindingMap);
         auto bindingFunc = sBindingFunctions.at(bindingType);
         context->putUserWriteable(name, bindingFunc(*context, result.value));
         if (!result.symbols.empty())
@@ -173,13 +181,25 @@ GraphicBuilder::createChild(const ContextPtr& context, const Object& json)
     }
 
     // Inflate the child
-    auto child = it->second(mGraphic, expanded, json);
+    auto child = it->second(mGraphic, context, json);
     if (child && child->hasChildren())
         addChildren(*child, json);
     return child;
 }
 
 
+bool
+GraphicBuilder::needsContext(const std::vector<Object>& items) const
+{
+    // Without multi-child support the first map in the array is always selected
+    for (const auto& item : items) {
+        if (item.isMap())
+            return item.has("bind");
+    }
+    return false;
+}
+
+
 GraphicElementPtr
 GraphicBuilder::createChildFromArray(const ContextPtr& context,
                                      const std::vector<Object>& items)
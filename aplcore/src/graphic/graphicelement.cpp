@@ -157,7 +157,9 @@ GraphicElement::setValue(GraphicPropertyKey key, const Object& value, bool useDi
         it->second.trigger(*this);
 
     if (useDirtyFlag && (it->second.flags & kPropOut) && mDirtyProperties.emplace(key).second) {
-        markAsDirty();
+        // The element registers with the Graphic once per frame, on its first dirty property
+        if (mDirtyProperties.size() == 1)
+            markAsDirty();
     }
 }
 
@@ -190,10 +192,9 @@ GraphicElement::serialize(rapidjson::Document::AllocatorType& allocator) const
 
 void
 GraphicElement::clearDirtyProperties() {
-    // TODO: Why are we clearing the children?  Shouldn't this be handled by the Graphic?
-    for(const auto& child : mChildren) {
-        child->clearDirtyProperties();
-    }
+    // Only this element is cleared.  Every element with dirty properties is registered with
+    // the Graphic, which clears each of them; walking the children here would touch the entire
+    // tree every frame that the root element changes.
     mDirtyProperties.clear();
 }
 
@@ -0,0 +1,213 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+#include "apl/livedata/chunkedobjectarray.h"
+
+namespace apl {
+
+const ChunkedObjectArray::size_type ChunkedObjectArray::BLOCK_SIZE;
+
+ChunkedObjectArray::ChunkedObjectArray(ObjectArray&& array)
+{
+    insert(0, std::move(array));
+}
+
+const Object&
+ChunkedObjectArray::at(size_type position) const
+{
+    auto block = findBlock(position);
+    return mBlocks.at(block).at(position - mStarts.at(block));
+}
+
+void
+ChunkedObjectArray::set(size_type position, Object&& value)
+{
+    auto block = findBlock(position);
+    mBlocks.at(block).at(position - mStarts.at(block)) = std::move(value);
+
+    // A single block is its own view; otherwise patch the cached view rather than dropping it
+    if (mFlatValid)
+        mFlat.at(position) = mBlocks[block][position - mStarts[block]];
+}
+
+void
+ChunkedObjectArray::insert(size_type position, ObjectArray&& values)
+{
+    if (values.empty())
+        return;
+
+    invalidate();
+
+    if (mBlocks.empty()) {
+        mBlocks.emplace_back(std::move(values));
+        mStarts.push_back(0);
+        mSize = mBlocks.back().size();
+        splitBlock(0);
+        return;
+    }
+
+    // Appending goes at the end of the last block
+    auto block = position >= mSize ? mBlocks.size() - 1 : findBlock(position);
+    auto& target = mBlocks[block];
+    auto offset = position - mStarts[block];
+    target.insert(target.begin() + offset,
+                  std::make_move_iterator(values.begin()),
+                  std::make_move_iterator(values.end()));
+    mSize += values.size();
+
+    splitBlock(block);
+    updateStarts(block);
+}
+
+void
+ChunkedObjectArray::insert(size_type position, Object&& value)
+{
+    invalidate();
+
+    if (mBlocks.empty()) {
+        mBlocks.emplace_back();
+        mStarts.push_back(0);
+    }
+
+    auto block = position >= mSize ? mBlocks.size() - 1 : findBlock(position);
+    auto& target = mBlocks[block];
+    target.insert(target.begin() + (position - mStarts[block]), std::move(value));
+    mSize++;
+
+    splitBlock(block);
+    updateStarts(block);
+}
+
+void
+ChunkedObjectArray::erase(size_type position, size_type count)
+{
+    if (count == 0)
+        return;
+
+    invalidate();
+
+    auto first = findBlock(position);
+    auto block = first;
+    auto offset = position - mStarts[block];
+    auto remaining = count;
+
+    while (remaining > 0 && block < mBlocks.size()) {
+        auto& target = mBlocks[block];
+        auto n = std::min(remaining, target.size() - offset);
+        target.erase(target.begin() + offset, target.begin() + offset + n);
+        remaining -= n;
+        mSize -= n;
+        offset = 0;
+
+        if (target.empty())
+            mBlocks.erase(mBlocks.begin() + block);
+        else
+            block++;
+    }
+
+    // Merge an undersized block into its neighbour so that the block count stays proportional
+    // to the size of the array
+    if (first < mBlocks.size() && mBlocks[first].size() < BLOCK_SIZE / 2) {
+        auto merge = first + 1 < mBlocks.size() ? first : (first > 0 ? first - 1 : first);
+        if (merge + 1 < mBlocks.size() && mBlocks[merge].size() + mBlocks[merge + 1].size() <= 2 * BLOCK_SIZE) {
+            auto& into = mBlocks[merge];
+            auto& from = mBlocks[merge + 1];
+            into.insert(into.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+            mBlocks.erase(mBlocks.begin() + merge + 1);
+            first = merge;
+        }
+    }
+
+    mStarts.resize(mBlocks.size());
+    updateStarts(first > 0 ? first - 1 : 0);
+}
+
+void
+ChunkedObjectArray::clear()
+{
+    invalidate();
+    mBlocks.clear();
+    mStarts.clear();
+    mSize = 0;
+}
+
+const ObjectArray&
+ChunkedObjectArray::getArray() const
+{
+    if (mBlocks.size() == 1)
+        return mBlocks.front();
+
+    if (!mFlatValid) {
+        mFlat.clear();
+        mFlat.reserve(mSize);
+        for (const auto& block : mBlocks)
+            mFlat.insert(mFlat.end(), block.begin(), block.end());
+        mFlatValid = true;
+    }
+
+    return mFlat;
+}
+
+size_t
+ChunkedObjectArray::findBlock(size_type position) const
+{
+    assert(position < mSize);
+    auto it = std::upper_bound(mStarts.begin(), mStarts.end(), position);
+    return std::distance(mStarts.begin(), it) - 1;
+}
+
+/**
+ * Break up a block that has grown past twice the block size into blocks of the standard size.
+ */
+void
+ChunkedObjectArray::splitBlock(size_t index)
+{
+    auto& block = mBlocks[index];
+    if (block.size() <= 2 * BLOCK_SIZE)
+        return;
+
+    std::vector<ObjectArray> pieces;
+    for (size_type start = 0 ; start < block.size() ; start += BLOCK_SIZE) {
+        auto end = std::min(start + BLOCK_SIZE, block.size());
+        pieces.emplace_back(std::make_move_iterator(block.begin() + start),
+                            std::make_move_iterator(block.begin() + end));
+    }
+
+    mBlocks.erase(mBlocks.begin() + index);
+    mBlocks.insert(mBlocks.begin() + index,
+                   std::make_move_iterator(pieces.begin()),
+                   std::make_move_iterator(pieces.end()));
+    mStarts.resize(mBlocks.size());
+    updateStarts(index);
+}
+
+void
+ChunkedObjectArray::updateStarts(size_t fromBlock)
+{
+    mStarts.resize(mBlocks.size());
+    size_type start = fromBlock > 0 && fromBlock <= mBlocks.size()
+                          ? mStarts[fromBlock - 1] + mBlocks[fromBlock - 1].size()
+                          : 0;
+    for (auto i = fromBlock ; i < mBlocks.size() ; i++) {
+        mStarts[i] = start;
+        start += mBlocks[i].size();
+    }
+}
+
+} // namespace apl
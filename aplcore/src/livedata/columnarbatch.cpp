@@ -0,0 +1,283 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+
+#include "apl/livedata/columnarbatch.h"
+#include "apl/primitives/object.h"
+
+namespace apl {
+
+const std::uint32_t ColumnarBatch::MAGIC;
+
+static size_t
+valueSize(ColumnarBatch::FieldType type)
+{
+    switch (type) {
+        case ColumnarBatch::kBoolean: return 1;
+        case ColumnarBatch::kNumber: return 8;
+        case ColumnarBatch::kString: return 8;
+    }
+    return 0;
+}
+
+static std::uint64_t
+readUnsigned(const std::uint8_t *data, size_t bytes)
+{
+    std::uint64_t result = 0;
+    for (size_t i = 0 ; i < bytes ; i++)
+        result |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+    return result;
+}
+
+static void
+writeUnsigned(std::vector<std::uint8_t>& out, std::uint64_t value, size_t bytes)
+{
+    for (size_t i = 0 ; i < bytes ; i++)
+        out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+}
+
+std::shared_ptr<ColumnarBatch>
+ColumnarBatch::create(std::vector<std::uint8_t>&& buffer)
+{
+    auto batch = std::make_shared<ColumnarBatch>(std::move(buffer));
+    if (!batch->parse())
+        return nullptr;
+    return batch;
+}
+
+/**
+ * Walk the header and check that every column and the string table fit in the buffer.  String
+ * offsets are checked as well so that value() never reads outside of the buffer.
+ */
+bool
+ColumnarBatch::parse()
+{
+    const auto *data = mBuffer.data();
+    auto length = mBuffer.size();
+    size_t offset = 0;
+
+    auto available = [&](size_t bytes) { return length - offset >= bytes; };
+
+    if (!available(10) || readUnsigned(data, 4) != MAGIC)
+        return false;
+
+    mRowCount = readUnsigned(data + 4, 4);
+    auto fieldCount = readUnsigned(data + 8, 2);
+    offset = 10;
+
+    for (size_t i = 0 ; i < fieldCount ; i++) {
+        if (!available(3))
+            return false;
+        auto type = data[offset];
+        auto nameLength = readUnsigned(data + offset + 1, 2);
+        offset += 3;
+        if (type > kString || !available(nameLength))
+            return false;
+
+        Field field;
+        field.name.assign(reinterpret_cast<const char *>(data + offset), nameLength);
+        field.type = static_cast<FieldType>(type);
+        offset += nameLength;
+
+        if (!mFieldIndex.emplace(field.name, mFields.size()).second)
+            return false;  // Duplicate field name
+        mFields.emplace_back(std::move(field));
+    }
+
+    for (auto& field : mFields) {
+        auto columnLength = valueSize(field.type) * mRowCount;
+        if (mRowCount != 0 && columnLength / mRowCount != valueSize(field.type))
+            return false;  // Overflow
+        if (!available(columnLength))
+            return false;
+        field.offset = offset;
+        offset += columnLength;
+    }
+
+    if (!available(4))
+        return false;
+    mStringTableLength = readUnsigned(data + offset, 4);
+    mStringTable = offset + 4;
+    offset += 4;
+    if (!available(mStringTableLength))
+        return false;
+
+    for (const auto& field : mFields) {
+        if (field.type != kString)
+            continue;
+        for (size_t row = 0 ; row < mRowCount ; row++) {
+            const auto *p = data + field.offset + 8 * row;
+            auto start = readUnsigned(p, 4);
+            auto count = readUnsigned(p + 4, 4);
+            if (start > mStringTableLength || count > mStringTableLength - start)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+int
+ColumnarBatch::fieldIndex(const std::string& name) const
+{
+    auto it = mFieldIndex.find(name);
+    return it == mFieldIndex.end() ? -1 : static_cast<int>(it->second);
+}
+
+Object
+ColumnarBatch::value(size_t row, size_t field) const
+{
+    const auto& f = mFields.at(field);
+    const auto *p = mBuffer.data() + f.offset + valueSize(f.type) * row;
+    switch (f.type) {
+        case kBoolean:
+            return Object(*p != 0);
+        case kNumber: {
+            auto bits = readUnsigned(p, 8);
+            double result;
+            std::memcpy(&result, &bits, sizeof(result));
+            return Object(result);
+        }
+        case kString: {
+            auto start = readUnsigned(p, 4);
+            auto count = readUnsigned(p + 4, 4);
+            return Object(std::string(reinterpret_cast<const char *>(mBuffer.data() + mStringTable + start), count));
+        }
+    }
+    return Object::NULL_OBJECT();
+}
+
+Object
+ColumnarBatch::row(size_t row) const
+{
+    return Object(std::make_shared<ColumnarRowData>(shared_from_this(), row));
+}
+
+const ObjectArray&
+ColumnarBatch::rows() const
+{
+    if (mRows.size() != mRowCount) {
+        mRows.clear();
+        mRows.reserve(mRowCount);
+        auto self = shared_from_this();
+        for (size_t i = 0 ; i < mRowCount ; i++)
+            mRows.emplace_back(std::make_shared<ColumnarRowData>(self, i));
+    }
+    return mRows;
+}
+
+/****************************************************************************/
+
+Object
+ColumnarRowData::get(const std::string& key) const
+{
+    auto index = mBatch->fieldIndex(key);
+    return index < 0 ? Object::NULL_OBJECT() : mBatch->value(mRow, index);
+}
+
+Object
+ColumnarRowData::opt(const std::string& key, const Object& def) const
+{
+    auto index = mBatch->fieldIndex(key);
+    return index < 0 ? def : mBatch->value(mRow, index);
+}
+
+const ObjectMap&
+ColumnarRowData::getMap() const
+{
+    if (mMap.size() != mBatch->fieldCount()) {
+        for (size_t i = 0 ; i < mBatch->fieldCount() ; i++)
+            mMap.emplace(mBatch->fieldName(i), mBatch->value(mRow, i));
+    }
+    return mMap;
+}
+
+void
+ColumnarRowData::accept(Visitor<Object>& visitor) const
+{
+    visitor.push();
+    for (size_t i = 0 ; !visitor.isAborted() && i < mBatch->fieldCount() ; i++) {
+        Object(mBatch->fieldName(i)).accept(visitor);
+        if (!visitor.isAborted()) {
+            visitor.push();
+            mBatch->value(mRow, i).accept(visitor);
+            visitor.pop();
+        }
+    }
+    visitor.pop();
+}
+
+std::string
+ColumnarRowData::toDebugString() const
+{
+    return "ColumnarRow<row=" + std::to_string(mRow) + " fields=" + std::to_string(mBatch->fieldCount()) + ">";
+}
+
+/****************************************************************************/
+
+ColumnarBatchBuilder&
+ColumnarBatchBuilder::add(const ObjectArray& values)
+{
+    mRows.emplace_back(values);
+    return *this;
+}
+
+std::vector<std::uint8_t>
+ColumnarBatchBuilder::build() const
+{
+    std::vector<std::uint8_t> out;
+    writeUnsigned(out, ColumnarBatch::MAGIC, 4);
+    writeUnsigned(out, mRows.size(), 4);
+    writeUnsigned(out, mFields.size(), 2);
+
+    for (const auto& field : mFields) {
+        out.push_back(field.second);
+        writeUnsigned(out, field.first.size(), 2);
+        out.insert(out.end(), field.first.begin(), field.first.end());
+    }
+
+    std::string strings;
+    for (size_t i = 0 ; i < mFields.size() ; i++) {
+        for (const auto& row : mRows) {
+            auto value = i < row.size() ? row.at(i) : Object::NULL_OBJECT();
+            switch (mFields[i].second) {
+                case ColumnarBatch::kBoolean:
+                    out.push_back(value.truthy() ? 1 : 0);
+                    break;
+                case ColumnarBatch::kNumber: {
+                    double number = value.isNull() ? 0 : value.asNumber();
+                    std::uint64_t bits;
+                    std::memcpy(&bits, &number, sizeof(bits));
+                    writeUnsigned(out, bits, 8);
+                    break;
+                }
+                case ColumnarBatch::kString: {
+                    auto s = value.isNull() ? std::string() : value.asString();
+                    writeUnsigned(out, strings.size(), 4);
+                    writeUnsigned(out, s.size(), 4);
+                    strings += s;
+                    break;
+                }
+            }
+        }
+    }
+
+    writeUnsigned(out, strings.size(), 4);
+    out.insert(out.end(), strings.begin(), strings.end());
+    return out;
+}
+
+} // namespace apl
@@ -243,12 +243,25 @@ LayoutRebuilder::rebuild()
     int ordinal = 1;
     int index = 0;
 
-    // Walk the list of new items
-    for (int newIndex = 0 ; newIndex < array->size() ; newIndex++) {
+    // Walk the list of new items.  The change log is compiled into runs of new and old items
+    // so that each index is mapped in constant time.
+    const auto& runs = array->indexMap().runs();
+    auto run = runs.begin();
+    size_t runOffset = 0;
+
+    for (int newIndex = 0 ; newIndex < array->size() ; newIndex++, runOffset++) {
+        while (run != runs.end() && runOffset >= run->count) {
+            run++;
+            runOffset = 0;
+        }
+
         const auto& data = array->at(newIndex);
-        auto p = array->newToOld(newIndex);
-        auto oldIndex = p.first;
-        auto needsRefresh = p.second;
+        auto oldIndex = -1;
+        auto needsRefresh = false;
+        if (run != runs.end() && run->oldIndex >= 0) {
+            oldIndex = run->oldIndex + static_cast<int>(runOffset);
+            needsRefresh = run->changed;
+        }
 
         if (oldIndex == -1) {  // Insert a new child - this one doesn't exist
             auto childContext = buildBaseChildContext(array, newIndex, index);
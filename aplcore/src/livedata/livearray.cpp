@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <iterator>
+
 #include "apl/livedata/livearray.h"
 #include "apl/livedata/livearraychange.h"
 
@@ -31,7 +33,7 @@ LiveArray::insert( size_type position, const Object& value )
     if (position > mArray.size())
         return false;
 
-    mArray.insert(mArray.begin() + position, value);
+    mArray.insert(position, Object(value));
     broadcast(LiveArrayChange::insert(position, 1));
     return true;
 }
@@ -42,7 +44,7 @@ LiveArray::insert( size_type position, Object && value )
     if (position > mArray.size())
         return false;
 
-    mArray.insert(mArray.begin() + position, std::move(value));
+    mArray.insert(position, std::move(value));
     broadcast(LiveArrayChange::insert(position, 1));
     return true;
 }
@@ -53,7 +55,7 @@ LiveArray::remove( size_type position, size_type count )
     if (count > mArray.size() || position > mArray.size() - count)
         return false;
 
-    mArray.erase(mArray.begin() + position, mArray.begin() + position + count);
+    mArray.erase(position, count);
 
     // Tell all trackers an item has been removed
     // If all items have been removed, just mark the array as replaced
@@ -68,7 +70,11 @@ LiveArray::update( size_type position, const Object& value )
     if (position >= mArray.size())
         return false;
 
-    mArray[position] = value;
+    // Storing the same value again is not a change
+    if (mArray.at(position) == value)
+        return true;
+
+    mArray.set(position, Object(value));
     broadcast(LiveArrayChange::update(position, 1));
     return true;
 }
@@ -79,7 +85,10 @@ LiveArray::update( size_type position, Object&& value )
     if (position >= mArray.size())
         return false;
 
-    mArray[position] = std::move(value);
+    if (mArray.at(position) == value)
+        return true;
+
+    mArray.set(position, std::move(value));
     broadcast(LiveArrayChange::update(position, 1));
     return true;
 }
@@ -88,7 +97,7 @@ void
 LiveArray::push_back( const Object& value )
 {
     auto position = mArray.size();
-    mArray.insert(mArray.begin() + position, value);
+    mArray.insert(position, Object(value));
     broadcast(LiveArrayChange::insert(position, 1));
 }
 
@@ -96,10 +105,88 @@ void
 LiveArray::push_back( Object&& value )
 {
     auto position = mArray.size();
-    mArray.insert(mArray.begin() + position, std::move(value));
+    mArray.insert(position, std::move(value));
     broadcast(LiveArrayChange::insert(position, 1));
 }
 
+bool
+LiveArray::applyPendingMutations()
+{
+    if (mPending->empty())
+        return false;
+
+    auto mutations = mPending->drain();
+    auto count = mutations.size();
+
+    // A clear makes everything queued before it irrelevant
+    size_t first = 0;
+    for (size_t i = count ; i > 0 ; i--) {
+        if (mutations[i - 1].command == LiveArrayMutation::CLEAR) {
+            first = i - 1;
+            break;
+        }
+    }
+
+    size_t applied = 0;
+    size_t coalesced = first;
+    size_t rejected = 0;
+
+    size_t i = first;
+    while (i < count) {
+        auto& mutation = mutations[i];
+        bool success = true;
+        switch (mutation.command) {
+            case LiveArrayMutation::INSERT:
+            case LiveArrayMutation::PUSH_BACK: {
+                // Gather a run of inserts that land one after another into a single range insert
+                auto isPush = mutation.command == LiveArrayMutation::PUSH_BACK;
+                auto position = isPush ? mArray.size() : mutation.position;
+                ObjectArray values;
+                values.emplace_back(std::move(mutation.value));
+                auto j = i + 1;
+                while (j < count && mutations[j].command == mutation.command &&
+                       (isPush || mutations[j].position == position + values.size())) {
+                    values.emplace_back(std::move(mutations[j].value));
+                    j++;
+                }
+
+                success = insert(position, std::make_move_iterator(values.begin()),
+                                 std::make_move_iterator(values.end()));
+                coalesced += j - i - 1;
+                i = j;
+                break;
+            }
+            case LiveArrayMutation::UPDATE:
+                // A later update of the same item overwrites this one
+                if (i + 1 < count && mutations[i + 1].command == LiveArrayMutation::UPDATE &&
+                    mutations[i + 1].position == mutation.position) {
+                    coalesced++;
+                    i++;
+                    continue;
+                }
+                success = update(mutation.position, std::move(mutation.value));
+                i++;
+                break;
+            case LiveArrayMutation::REMOVE:
+                success = remove(mutation.position, mutation.count);
+                i++;
+                break;
+            case LiveArrayMutation::CLEAR:
+                clear();
+                i++;
+                break;
+        }
+
+        if (success)
+            applied++;
+        else
+            rejected++;
+    }
+
+    mPending->record(applied, coalesced, rejected);
+    return applied > 0;
+}
+
 void
 LiveArray::broadcast(const LiveArrayChange& command)
 {
@@ -0,0 +1,144 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "apl/livedata/livearrayindexmap.h"
+
+namespace apl {
+
+using Run = LiveArrayIndexMap::Run;
+using size_type = LiveArrayIndexMap::size_type;
+
+/**
+ * Make sure that a run starts at the given position in the new array, splitting a run if needed.
+ * @return The offset of the run that starts at that position (or the number of runs if the
+ *         position is at or past the end of the array).
+ */
+static size_t
+splitAt(std::vector<Run>& runs, size_type position)
+{
+    size_type start = 0;
+    for (size_t i = 0 ; i < runs.size() ; i++) {
+        auto& run = runs[i];
+        if (position == start)
+            return i;
+
+        if (position < start + run.count) {
+            auto offset = position - start;
+            Run tail = { run.count - offset,
+                         run.oldIndex < 0 ? -1 : run.oldIndex + static_cast<int>(offset),
+                         run.changed };
+            run.count = offset;
+            runs.insert(runs.begin() + i + 1, tail);
+            return i + 1;
+        }
+
+        start += run.count;
+    }
+
+    return runs.size();
+}
+
+LiveArrayIndexMap::LiveArrayIndexMap(const std::vector<LiveArrayChange>& changes, size_type newSize)
+{
+    // Work backwards from the final size to find the size of the original array
+    size_type inserted = 0;
+    size_type removed = 0;
+    for (const auto& change : changes) {
+        if (change.command() == LiveArrayChange::INSERT)
+            inserted += change.count();
+        else if (change.command() == LiveArrayChange::REMOVE)
+            removed += change.count();
+    }
+    size_type oldSize = newSize + removed > inserted ? newSize + removed - inserted : 0;
+
+    std::vector<Run> runs;
+    if (oldSize > 0)
+        runs.push_back({oldSize, 0, false});
+
+    // Replay the changes in order on the run list
+    for (const auto& change : changes) {
+        auto position = change.position();
+        auto count = change.count();
+        if (count == 0)
+            continue;
+
+        switch (change.command()) {
+            case LiveArrayChange::INSERT: {
+                auto index = splitAt(runs, position);
+                runs.insert(runs.begin() + index, Run{count, -1, false});
+                break;
+            }
+            case LiveArrayChange::REMOVE: {
+                auto first = splitAt(runs, position);
+                auto last = splitAt(runs, position + count);
+                runs.erase(runs.begin() + first, runs.begin() + last);
+                break;
+            }
+            case LiveArrayChange::UPDATE: {
+                auto first = splitAt(runs, position);
+                auto last = splitAt(runs, position + count);
+                for (auto i = first ; i < last ; i++) {
+                    if (runs[i].oldIndex >= 0)
+                        runs[i].changed = true;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Merge adjacent runs that continue each other
+    for (const auto& run : runs) {
+        if (!mRuns.empty()) {
+            auto& last = mRuns.back();
+            bool bothInserted = last.oldIndex < 0 && run.oldIndex < 0;
+            bool contiguous = last.oldIndex >= 0 && run.oldIndex == last.oldIndex + static_cast<int>(last.count) &&
+                              last.changed == run.changed;
+            if (bothInserted || contiguous) {
+                last.count += run.count;
+                continue;
+            }
+        }
+        mRuns.push_back(run);
+    }
+
+    mStarts.reserve(mRuns.size());
+    size_type start = 0;
+    for (const auto& run : mRuns) {
+        mStarts.push_back(start);
+        start += run.count;
+    }
+}
+
+std::pair<int, bool>
+LiveArrayIndexMap::newToOld(size_type index) const
+{
+    auto it = std::upper_bound(mStarts.begin(), mStarts.end(), index);
+    if (it == mStarts.begin())
+        return {-1, false};
+
+    auto offset = std::distance(mStarts.begin(), it) - 1;
+    const auto& run = mRuns.at(offset);
+    auto delta = index - mStarts.at(offset);
+    if (delta >= run.count || run.oldIndex < 0)
+        return {-1, false};
+
+    return {run.oldIndex + static_cast<int>(delta), run.changed};
+}
+
+} // namespace apl
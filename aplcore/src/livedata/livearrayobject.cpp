@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include "apl/livedata/livearrayobject.h"
 #include "apl/livedata/livearray.h"
 #include "apl/livedata/livearraychange.h"
@@ -62,13 +64,71 @@ LiveArrayObject::getArray() const
 void
 LiveArrayObject::accept(Visitor<Object>& visitor) const
 {
-    const auto& array = mLiveArray->getArray();
     visitor.push();
-    for (auto it = array.begin(); !visitor.isAborted() && it != array.end(); it++)
-        it->accept(visitor);
+    mLiveArray->forEach([&](const Object& item) {
+        if (!visitor.isAborted())
+            item.accept(visitor);
+    });
     visitor.pop();
 }
 
+/**
+ * Try to fold a change into the change that immediately preceded it.  Updates of overlapping or
+ * adjacent ranges merge, inserts that land inside or next to an insert extend it, updates and
+ * removes of freshly inserted items are absorbed by the insert, and removes at the same position
+ * merge.
+ * @param changes The list of changes.  Must not be empty.
+ * @param change The new change.
+ * @return True if the change was folded in.
+ */
+static bool
+coalesceChange(std::vector<LiveArrayChange>& changes, const LiveArrayChange& change)
+{
+    auto& last = changes.back();
+    auto p = last.position();
+    auto n = last.count();
+    auto q = change.position();
+    auto m = change.count();
+
+    switch (last.command()) {
+        case LiveArrayChange::UPDATE:
+            if (change.command() == LiveArrayChange::UPDATE && q <= p + n && p <= q + m) {
+                auto start = std::min(p, q);
+                last = LiveArrayChange::update(start, std::max(p + n, q + m) - start);
+                return true;
+            }
+            break;
+
+        case LiveArrayChange::INSERT:
+            if (change.command() == LiveArrayChange::INSERT && q >= p && q <= p + n) {
+                last = LiveArrayChange::insert(p, n + m);
+                return true;
+            }
+            if (change.command() == LiveArrayChange::UPDATE && q >= p && q + m <= p + n)
+                return true;
+            if (change.command() == LiveArrayChange::REMOVE && q >= p && q + m <= p + n) {
+                if (m == n)
+                    changes.pop_back();
+                else
+                    last = LiveArrayChange::insert(p, n - m);
+                return true;
+            }
+            break;
+
+        case LiveArrayChange::REMOVE:
+            if (change.command() == LiveArrayChange::REMOVE && (q == p || q + m == p)) {
+                last = LiveArrayChange::remove(std::min(p, q), n + m);
+                return true;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
 void
 LiveArrayObject::handleArrayMessage(const LiveArrayChange& change)
 {
@@ -80,17 +140,40 @@ LiveArrayObject::handleArrayMessage(const LiveArrayChange& change)
         mReplaced = true;
         mChanges.clear();
     }
-    else {
+    else if (mChanges.empty() || !coalesceChange(mChanges, change)) {
         mChanges.push_back(change);
     }
 
+    mIndexMap.reset();
     markDirty();
 }
 
+void
+LiveArrayObject::applyPendingMutations() {
+    mLiveArray->applyPendingMutations();
+}
+
 void
 LiveArrayObject::flush() {
-    LiveDataObject::flush();
+    // Changes that cancelled each other out leave nothing to rebuild or recalculate
+    if (mReplaced || !mChanges.empty())
+        LiveDataObject::flush();
+
     mChanges.clear();
+    mIndexMap.reset();
+}
+
+const LiveArrayIndexMap&
+LiveArrayObject::indexMap()
+{
+    if (!mIndexMap) {
+        if (mReplaced)  // Every item is new
+            mIndexMap.reset(new LiveArrayIndexMap({LiveArrayChange::insert(0, size())}, size()));
+        else
+            mIndexMap.reset(new LiveArrayIndexMap(mChanges, size()));
+    }
+
+    return *mIndexMap;
 }
 
 /**
@@ -102,36 +185,7 @@ LiveArrayObject::flush() {
 std::pair<int, bool>
 LiveArrayObject::newToOld(ObjectArray::size_type index)
 {
-    if (mReplaced)
-        return {-1, false};
-
-    bool changed = false;
-
-    for (auto it = mChanges.rbegin() ; it != mChanges.rend() ; it++) {
-        auto cmd = it->command();
-        auto position = it->position();
-        auto count = it->count();
-        switch (cmd) {
-            case LiveArrayChange::REMOVE:
-                if (index >= position)
-                    index += count;
-                break;
-            case LiveArrayChange::UPDATE:
-                if (index >= position && index < position + count)
-                    changed = true;
-                break;
-            case LiveArrayChange::INSERT:
-                if (index >= position + count)
-                    index -= count;
-                else if (index >= position)
-                    return {-1, false};
-                break;
-            default:
-                break;
-        }
-    }
-
-    return { index, changed };
+    return indexMap().newToOld(index);
 }
 
 std::shared_ptr<LiveDataObject>
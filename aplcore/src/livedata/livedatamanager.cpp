@@ -21,6 +21,10 @@ namespace apl {
 void
 LiveDataManager::flushDirty()
 {
+    // Mutations queued by producer handles mark their trackers dirty as they are applied
+    for (const auto& m : mTrackers)
+        m->applyPendingMutations();
+
     for (const auto& m : mDirty)
         m->preFlush();
 
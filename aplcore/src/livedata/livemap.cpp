@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <unordered_map>
+
 #include "apl/livedata/livemap.h"
 #include "apl/livedata/livemapchange.h"
 
@@ -38,11 +40,77 @@ LiveMap::remove(const std::string& key)
     auto it = mMap.find(key);
     if (it == mMap.end())
         return false;
+    auto previous = std::move(it->second);
     mMap.erase(it);
-    broadcast(LiveMapChange::remove(key));
+    broadcast(LiveMapChange::remove(key, previous));
     return true;
 }
 
+bool
+LiveMap::applyPendingMutations()
+{
+    if (mPending->empty())
+        return false;
+
+    auto mutations = mPending->drain();
+    auto count = mutations.size();
+
+    // A clear or replace makes everything queued before it irrelevant
+    size_t first = 0;
+    for (size_t i = count ; i > 0 ; i--) {
+        auto command = mutations[i - 1].command;
+        if (command == LiveMapMutation::CLEAR || command == LiveMapMutation::REPLACE) {
+            first = i - 1;
+            break;
+        }
+    }
+
+    // Only the last set or remove of each key matters
+    std::unordered_map<std::string, size_t> lastChange;
+    for (size_t i = first ; i < count ; i++) {
+        auto command = mutations[i].command;
+        if (command == LiveMapMutation::SET || command == LiveMapMutation::REMOVE)
+            lastChange[mutations[i].key] = i;
+    }
+
+    size_t applied = 0;
+    size_t coalesced = first;
+    size_t rejected = 0;
+
+    for (size_t i = first ; i < count ; i++) {
+        auto& mutation = mutations[i];
+        switch (mutation.command) {
+            case LiveMapMutation::SET:
+                if (lastChange[mutation.key] != i) {
+                    coalesced++;
+                    continue;
+                }
+                set(mutation.key, std::move(mutation.value));
+                applied++;
+                break;
+            case LiveMapMutation::REMOVE:
+                if (lastChange[mutation.key] != i)
+                    coalesced++;
+                else if (remove(mutation.key))
+                    applied++;
+                else
+                    rejected++;
+                break;
+            case LiveMapMutation::REPLACE:
+                replace(std::move(mutation.map));
+                applied++;
+                break;
+            case LiveMapMutation::CLEAR:
+                clear();
+                applied++;
+                break;
+        }
+    }
+
+    mPending->record(applied, coalesced, rejected);
+    return applied > 0;
+}
+
 void
 LiveMap::broadcast(const LiveMapChange& command)
 {
@@ -56,4 +124,10 @@ LiveMap::broadcastSet(const std::string& key)
     broadcast(LiveMapChange::set(key));
 }
 
+void
+LiveMap::broadcastSet(const std::string& key, const Object& previous)
+{
+    broadcast(LiveMapChange::set(key, previous));
+}
+
 } // namespace apl
\ No newline at end of file
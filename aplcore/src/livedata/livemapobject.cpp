@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include "apl/livedata/livemapobject.h"
 #include "apl/livedata/livemap.h"
 #include "apl/livedata/livemapchange.h"
@@ -71,10 +73,22 @@ LiveMapObject::accept(Visitor<Object>& visitor) const
     visitor.pop();
 }
 
+void
+LiveMapObject::applyPendingMutations() {
+    mLiveMap->applyPendingMutations();
+}
+
 void
 LiveMapObject::flush() {
-    LiveDataObject::flush();
+    // If every change has been undone there is nothing for the bindings to recalculate
+    if (!mReplaced)
+        dropUnchanged();
+
+    if (mReplaced || !mChanges.empty())
+        LiveDataObject::flush();
+
     mChanges.clear();
+    mChangeIndex.clear();
     mChanged.clear();
 }
 
@@ -83,10 +97,15 @@ LiveMapObject::getChanges() {
     // If we've been replaced, EVERYTHING has been changed or updated in some way
     if (mReplaced) {
         const auto& map = mLiveMap->getMap();
-        for (const auto& m : map)
+        for (const auto& m : map) {
+            mChangeIndex.emplace(m.first, mChanges.size());
             mChanges.push_back(LiveMapChange::set(m.first));
+        }
         mReplaced = false;
     }
+    else {
+        dropUnchanged();
+    }
     return mChanges;
 }
 
@@ -112,14 +131,52 @@ LiveMapObject::handleMapMessage(const LiveMapChange& change)
     if (change.command() == LiveMapChange::REPLACE) {
         mReplaced = true;
         mChanges.clear();
+        mChangeIndex.clear();
     }
     else {
-        mChanges.push_back(change);
+        // Fold repeated changes to a key into one change, remembering the value before the first
+        auto it = mChangeIndex.find(change.key());
+        if (it != mChangeIndex.end()) {
+            mChanges[it->second] = mChanges[it->second].then(change);
+        }
+        else {
+            mChangeIndex.emplace(change.key(), mChanges.size());
+            mChanges.push_back(change);
+        }
+        mChanged.clear();
     }
 
     markDirty();
 }
 
+/**
+ * Remove changes that leave a key exactly as it was at the last flush: a key that was set back to
+ * its original value, or a key that was added and then removed.
+ */
+void
+LiveMapObject::dropUnchanged()
+{
+    auto it = std::remove_if(mChanges.begin(), mChanges.end(), [&](const LiveMapChange& change) {
+        if (change.command() == LiveMapChange::REMOVE)
+            return !change.hadPrevious();
+
+        if (!change.hadPrevious())
+            return false;
+
+        auto value = mLiveMap->getMap().find(change.key());
+        return value != mLiveMap->getMap().end() && value->second == change.previous();
+    });
+
+    if (it == mChanges.end())
+        return;
+
+    mChanges.erase(it, mChanges.end());
+    mChangeIndex.clear();
+    for (size_t i = 0 ; i < mChanges.size() ; i++)
+        mChangeIndex.emplace(mChanges[i].key(), i);
+    mChanged.clear();
+}
+
 std::shared_ptr<LiveDataObject>
 LiveMapObject::ObjectType::getLiveDataObject(const Object::DataHolder& dataHolder) const
 {
@@ -71,7 +71,7 @@ RectPath::setRect(Rect rect)
         return false;
 
     mRect = rect;
-    mModified = true;
+    setModified();
     return true;
 }
 
@@ -109,7 +109,7 @@ RoundedRectPath::setRoundedRect(const RoundedRect& roundedRect)
         return false;
 
     mRoundedRect = roundedRect;
-    mModified = true;
+    setModified();
     return true;
 }
 
@@ -150,7 +150,7 @@ FramePath::setRoundedRect(const RoundedRect& roundedRect)
         return false;
 
     mRoundedRect = roundedRect;
-    mModified = true;
+    setModified();
     return true;
 }
 
@@ -161,7 +161,7 @@ FramePath::setInset(float inset)
         return false;
 
     mInset = inset;
-    mModified = true;
+    setModified();
     return true;
 }
 
@@ -0,0 +1,667 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "apl/scenegraph/tessellation.h"
+#include "apl/scenegraph/path.h"
+#include "apl/scenegraph/pathop.h"
+
+namespace apl {
+namespace sg {
+
+static const float MIN_TOLERANCE = 0.001f;
+static const int MAX_SUBDIVISIONS = 1024;
+static const int SCALE_BUCKETS_PER_OCTAVE = 4;
+
+/**
+ * @return The largest scaling factor applied by the transform
+ */
+static float
+transformScale(const Transform2D& transform)
+{
+    auto scale = std::max(transform.getXScaling(), transform.getYScaling());
+    return scale > 0 ? scale : 1.0f;
+}
+
+/**
+ * @return The tolerance converted into the local coordinate space
+ */
+static float
+localTolerance(const Transform2D& transform, float tolerance)
+{
+    return std::max(tolerance, MIN_TOLERANCE) / transformScale(transform);
+}
+
+static int
+clampSubdivisions(float value)
+{
+    if (!std::isfinite(value) || value < 1.0f)
+        return 1;
+    return std::min(static_cast<int>(std::ceil(value)), MAX_SUBDIVISIONS);
+}
+
+/**
+ * The number of line segments needed to approximate a circular arc of the given radius and
+ * sweep so that no segment strays further than the tolerance from the true arc.
+ */
+static int
+arcSubdivisions(float radius, float sweep, float tolerance)
+{
+    if (radius <= tolerance)
+        return 1;
+    auto step = 2 * std::acos(1 - tolerance / radius);
+    return clampSubdivisions(std::abs(sweep) / step);
+}
+
+/**
+ * Append an arc (excluding the starting point) centered on (cx,cy)
+ */
+static void
+appendArc(std::vector<Point>& points, float cx, float cy, float radius,
+          float startAngle, float sweep, float tolerance)
+{
+    auto n = arcSubdivisions(radius, sweep, tolerance);
+    for (int i = 1 ; i <= n ; i++) {
+        auto angle = startAngle + sweep * i / n;
+        points.emplace_back(cx + radius * std::cos(angle), cy + radius * std::sin(angle));
+    }
+}
+
+/**
+ * Flatten a rounded rectangle into a single closed contour.  The contour runs counter-clockwise
+ * on the screen (top-left, bottom-left, bottom-right, top-right) to match RectPath.
+ */
+static Contour
+flattenRoundedRect(const RoundedRect& roundedRect, float tolerance)
+{
+    const auto& rect = roundedRect.rect();
+    const auto& radii = roundedRect.radii();
+    const auto maxRadius = std::min(rect.getWidth(), rect.getHeight()) / 2;
+    auto clamp = [&](float r) { return std::max(0.0f, std::min(r, maxRadius)); };
+
+    const auto l = rect.getLeft();
+    const auto t = rect.getTop();
+    const auto r = rect.getRight();
+    const auto b = rect.getBottom();
+    const auto tl = clamp(radii.topLeft());
+    const auto tr = clamp(radii.topRight());
+    const auto bl = clamp(radii.bottomLeft());
+    const auto br = clamp(radii.bottomRight());
+    const auto halfPi = static_cast<float>(M_PI / 2);
+
+    Contour contour;
+    contour.closed = true;
+    auto& p = contour.points;
+
+    // Walk clockwise in screen space and reverse at the end
+    p.emplace_back(l, t + tl);
+    if (tl > 0) appendArc(p, l + tl, t + tl, tl, 2 * halfPi, halfPi, tolerance);
+    p.emplace_back(r - tr, t);
+    if (tr > 0) appendArc(p, r - tr, t + tr, tr, 3 * halfPi, halfPi, tolerance);
+    p.emplace_back(r, b - br);
+    if (br > 0) appendArc(p, r - br, b - br, br, 0, halfPi, tolerance);
+    p.emplace_back(l + bl, b);
+    if (bl > 0) appendArc(p, l + bl, b - bl, bl, halfPi, halfPi, tolerance);
+
+    // Drop duplicate points created where a corner has no radius
+    p.erase(std::unique(p.begin(), p.end()), p.end());
+    if (p.size() > 1 && p.front() == p.back())
+        p.pop_back();
+
+    std::reverse(p.begin(), p.end());
+    return contour;
+}
+
+/**
+ * Helper for flattening general paths
+ */
+class Flattener {
+public:
+    Flattener(Contours& contours, float tolerance) : mContours(contours), mTolerance(tolerance) {}
+
+    void moveTo(const float *p) {
+        finish();
+        mStart = mLast = Point(p[0], p[1]);
+    }
+
+    void lineTo(const float *p) {
+        begin();
+        add(Point(p[0], p[1]));
+    }
+
+    void quadTo(const float *p) {
+        begin();
+        const auto p0 = mLast;
+        const Point p1(p[0], p[1]);
+        const Point p2(p[2], p[3]);
+
+        // Wang's formula: the second difference bounds the deviation of the chord
+        const auto dd = length(p0 - p1 - p1 + p2);
+        const auto n = clampSubdivisions(std::sqrt(dd / (4 * mTolerance)));
+        for (int i = 1 ; i < n ; i++) {
+            const float t = static_cast<float>(i) / n;
+            const float mt = 1 - t;
+            add(Point(p0.getX() * mt * mt + 2 * p1.getX() * t * mt + p2.getX() * t * t,
+                      p0.getY() * mt * mt + 2 * p1.getY() * t * mt + p2.getY() * t * t));
+        }
+        add(p2);
+    }
+
+    void cubicTo(const float *p) {
+        begin();
+        const auto p0 = mLast;
+        const Point p1(p[0], p[1]);
+        const Point p2(p[2], p[3]);
+        const Point p3(p[4], p[5]);
+
+        const auto dd = std::max(length(p0 - p1 - p1 + p2), length(p1 - p2 - p2 + p3));
+        const auto n = clampSubdivisions(std::sqrt(3 * dd / (4 * mTolerance)));
+        for (int i = 1 ; i < n ; i++) {
+            const float t = static_cast<float>(i) / n;
+            const float mt = 1 - t;
+            const float a = mt * mt * mt, b = 3 * t * mt * mt, c = 3 * t * t * mt, d = t * t * t;
+            add(Point(p0.getX() * a + p1.getX() * b + p2.getX() * c + p3.getX() * d,
+                      p0.getY() * a + p1.getY() * b + p2.getY() * c + p3.getY() * d));
+        }
+        add(p3);
+    }
+
+    void close() {
+        if (mCurrent) {
+            mCurrent->closed = true;
+            mCurrent = nullptr;
+        }
+        mLast = mStart;
+    }
+
+    void finish() { mCurrent = nullptr; }
+
+private:
+    static float length(const Point& p) { return std::sqrt(p.getX() * p.getX() + p.getY() * p.getY()); }
+
+    void begin() {
+        if (!mCurrent) {
+            mContours.emplace_back();
+            mCurrent = &mContours.back();
+            mCurrent->points.emplace_back(mLast);
+        }
+    }
+
+    void add(const Point& p) {
+        if (p != mCurrent->points.back())
+            mCurrent->points.emplace_back(p);
+        mLast = p;
+    }
+
+    Contours& mContours;
+    Contour *mCurrent = nullptr;
+    float mTolerance;
+    Point mStart;
+    Point mLast;
+};
+
+Contours
+flattenPath(const Path& path, const Transform2D& transform, float tolerance)
+{
+    const auto tol = localTolerance(transform, tolerance);
+    Contours result;
+
+    switch (path.type()) {
+        case Path::kRect: {
+            const auto& rect = RectPath::cast(&path)->getRect();
+            Contour contour;
+            contour.closed = true;
+            contour.points = {rect.getTopLeft(),
+                              Point(rect.getLeft(), rect.getBottom()),
+                              rect.getBottomRight(),
+                              Point(rect.getRight(), rect.getTop())};
+            result.emplace_back(std::move(contour));
+            break;
+        }
+        case Path::kRoundedRect:
+            result.emplace_back(flattenRoundedRect(RoundedRectPath::cast(&path)->getRoundedRect(), tol));
+            break;
+        case Path::kFrame: {
+            auto frame = FramePath::cast(&path);
+            result.emplace_back(flattenRoundedRect(frame->getRoundedRect(), tol));
+            auto inner = frame->getRoundedRect().inset(frame->getInset());
+            if (!inner.empty()) {
+                result.emplace_back(flattenRoundedRect(inner, tol));
+                auto& points = result.back().points;
+                std::reverse(points.begin(), points.end());
+            }
+            break;
+        }
+        case Path::kGeneral: {
+            auto general = GeneralPath::cast(&path);
+            const auto& commands = general->getValue();
+            const auto& points = general->getPoints();
+            const float *ptr = points.data();
+            const float *end = ptr + points.size();
+            Flattener flattener(result, tol);
+
+            for (const auto& m : commands) {
+                switch (m) {
+                    case 'M':
+                        if (ptr + 2 > end) return result;
+                        flattener.moveTo(ptr);
+                        ptr += 2;
+                        break;
+                    case 'L':
+                        if (ptr + 2 > end) return result;
+                        flattener.lineTo(ptr);
+                        ptr += 2;
+                        break;
+                    case 'Q':
+                        if (ptr + 4 > end) return result;
+                        flattener.quadTo(ptr);
+                        ptr += 4;
+                        break;
+                    case 'C':
+                        if (ptr + 6 > end) return result;
+                        flattener.cubicTo(ptr);
+                        ptr += 6;
+                        break;
+                    case 'Z':
+                        flattener.close();
+                        break;
+                    default:
+                        break;
+                }
+            }
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*****************************************************************************/
+
+namespace {
+
+struct Vec {
+    float x, y;
+    Vec(float x, float y) : x(x), y(y) {}
+    explicit Vec(const Point& p) : x(p.getX()), y(p.getY()) {}
+    Vec operator+(const Vec& o) const { return {x + o.x, y + o.y}; }
+    Vec operator-(const Vec& o) const { return {x - o.x, y - o.y}; }
+    Vec operator*(float s) const { return {x * s, y * s}; }
+    float dot(const Vec& o) const { return x * o.x + y * o.y; }
+    float cross(const Vec& o) const { return x * o.y - y * o.x; }
+    float length() const { return std::sqrt(x * x + y * y); }
+    Vec unit() const { auto len = length(); return len > 0 ? Vec(x / len, y / len) : Vec(0, 0); }
+    Vec normal() const { return {-y, x}; }
+    Point point() const { return {x, y}; }
+};
+
+/**
+ * Accumulates closed polygons, forcing every polygon to the same orientation so that the
+ * union can be filled with the non-zero winding rule.
+ */
+class Outline {
+public:
+    explicit Outline(Contours& contours) : mContours(contours) {}
+
+    void polygon(std::vector<Vec>&& vertices) {
+        if (vertices.size() < 3)
+            return;
+
+        float area = 0;
+        for (size_t i = 0, j = vertices.size() - 1 ; i < vertices.size() ; j = i++)
+            area += vertices[j].cross(vertices[i]);
+        if (area == 0)
+            return;
+        if (area < 0)
+            std::reverse(vertices.begin(), vertices.end());
+
+        Contour contour;
+        contour.closed = true;
+        contour.points.reserve(vertices.size());
+        for (const auto& v : vertices)
+            contour.points.emplace_back(v.point());
+        mContours.emplace_back(std::move(contour));
+    }
+
+    void circle(const Vec& center, float radius, float tolerance) {
+        auto n = std::max(arcSubdivisions(radius, 2 * M_PI, tolerance), 8);
+        std::vector<Vec> vertices;
+        vertices.reserve(n);
+        for (int i = 0 ; i < n ; i++) {
+            auto angle = 2 * M_PI * i / n;
+            vertices.emplace_back(center.x + radius * std::cos(angle), center.y + radius * std::sin(angle));
+        }
+        polygon(std::move(vertices));
+    }
+
+private:
+    Contours& mContours;
+};
+
+/**
+ * Split contours into dashes.  The dash array lengths are scaled by the ratio of the actual
+ * length of the path to the author-supplied path length, if there is one.
+ */
+Contours
+applyDashes(const Contours& contours, const StrokePathOp& stroke)
+{
+    const auto& dashes = stroke.dashes;
+    float patternLength = 0;
+    for (const auto& d : dashes)
+        patternLength += std::max(0.0f, d);
+    if (dashes.size() < 2 || patternLength <= 0)
+        return contours;
+
+    float totalLength = 0;
+    for (const auto& contour : contours) {
+        const auto& p = contour.points;
+        for (size_t i = 1 ; i < p.size() ; i++)
+            totalLength += (Vec(p[i]) - Vec(p[i - 1])).length();
+        if (contour.closed && p.size() > 1)
+            totalLength += (Vec(p.front()) - Vec(p.back())).length();
+    }
+
+    const float scale = stroke.pathLength > 0 ? totalLength / stroke.pathLength : 1.0f;
+    patternLength *= scale;
+    if (patternLength < 1e-6f)
+        return contours;
+
+    Contours result;
+    for (const auto& contour : contours) {
+        auto points = contour.points;
+        if (contour.closed && points.size() > 1)
+            points.emplace_back(points.front());
+
+        // Each contour restarts the dash pattern at the dash offset
+        float offset = std::fmod(stroke.dashOffset * scale, patternLength);
+        if (offset < 0)
+            offset += patternLength;
+        size_t index = 0;
+        while (offset >= std::max(0.0f, dashes[index]) * scale) {
+            offset -= std::max(0.0f, dashes[index]) * scale;
+            index = (index + 1) % dashes.size();
+        }
+        float remaining = std::max(0.0f, dashes[index]) * scale - offset;
+        bool on = (index % 2) == 0;
+
+        Contour current;
+        if (on && !points.empty())
+            current.points.emplace_back(points.front());
+
+        for (size_t i = 1 ; i < points.size() ; i++) {
+            Vec a(points[i - 1]);
+            Vec b(points[i]);
+            float segment = (b - a).length();
+            float consumed = 0;
+
+            while (segment - consumed > remaining) {
+                consumed += remaining;
+                auto split = (a + (b - a) * (consumed / segment)).point();
+                if (on) {
+                    current.points.emplace_back(split);
+                    result.emplace_back(std::move(current));
+                    current = Contour();
+                }
+                else {
+                    current.points.emplace_back(split);
+                }
+                on = !on;
+                index = (index + 1) % dashes.size();
+                remaining = std::max(0.0f, dashes[index]) * scale;
+            }
+
+            remaining -= segment - consumed;
+            if (on)
+                current.points.emplace_back(b.point());
+        }
+
+        if (on && current.points.size() > 1)
+            result.emplace_back(std::move(current));
+    }
+
+    return result;
+}
+
+void
+addCap(Outline& outline, const Vec& point, const Vec& direction, float halfWidth,
+       GraphicLineCap cap, float tolerance)
+{
+    switch (cap) {
+        case kGraphicLineCapRound:
+            outline.circle(point, halfWidth, tolerance);
+            break;
+        case kGraphicLineCapSquare: {
+            auto n = direction.normal() * halfWidth;
+            auto d = direction * halfWidth;
+            outline.polygon({point + n, point + n + d, point - n + d, point - n});
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void
+addJoin(Outline& outline, const Vec& point, const Vec& d0, const Vec& d1, float halfWidth,
+        const StrokePathOp& stroke, float tolerance)
+{
+    auto cross = d0.cross(d1);
+    if (std::abs(cross) < 1e-6f && d0.dot(d1) > 0)
+        return;  // Collinear; the segment quads already meet
+
+    // The join is added on the outside of the turn
+    const float side = cross > 0 ? -1.0f : 1.0f;
+    const auto n0 = d0.normal() * (side * halfWidth);
+    const auto n1 = d1.normal() * (side * halfWidth);
+
+    switch (stroke.lineJoin) {
+        case kGraphicLineJoinRound:
+            outline.circle(point, halfWidth, tolerance);
+            break;
+        case kGraphicLineJoinMiter: {
+            auto cosTheta = d0.normal().dot(d1.normal());  // Angle between the two normals
+            if (1 + cosTheta > 1e-6f) {
+                auto ratio = std::sqrt(2 / (1 + cosTheta));  // Miter length / stroke width
+                if (ratio <= stroke.miterLimit) {
+                    auto tip = point + (n0 + n1) * (1 / (1 + cosTheta));
+                    outline.polygon({point, point + n0, tip, point + n1});
+                    break;
+                }
+            }
+            outline.polygon({point, point + n0, point + n1});
+            break;
+        }
+        default:  // Bevel
+            outline.polygon({point, point + n0, point + n1});
+            break;
+    }
+}
+
+} // anonymous namespace
+
+Contours
+strokeContours(const Contours& contours, const StrokePathOp& stroke,
+               const Transform2D& transform, float tolerance)
+{
+    Contours result;
+    if (stroke.strokeWidth <= 0)
+        return result;
+
+    const auto tol = localTolerance(transform, tolerance);
+    const auto halfWidth = stroke.strokeWidth / 2;
+    Outline outline(result);
+
+    for (const auto& contour : applyDashes(contours, stroke)) {
+        const auto& p = contour.points;
+        if (p.empty())
+            continue;
+
+        // A zero-length sub-path only draws with round or square caps
+        if (p.size() == 1) {
+            addCap(outline, Vec(p[0]), Vec(1, 0), halfWidth, stroke.lineCap, tol);
+            if (stroke.lineCap == kGraphicLineCapSquare)
+                addCap(outline, Vec(p[0]), Vec(-1, 0), halfWidth, stroke.lineCap, tol);
+            continue;
+        }
+
+        std::vector<Vec> vertices;
+        vertices.reserve(p.size() + 1);
+        for (const auto& point : p)
+            vertices.emplace_back(point);
+        if (contour.closed && !(p.front() == p.back()))
+            vertices.emplace_back(p.front());
+
+        const auto count = vertices.size();
+        for (size_t i = 1 ; i < count ; i++) {
+            const auto& a = vertices[i - 1];
+            const auto& b = vertices[i];
+            auto d = (b - a).unit();
+            auto n = d.normal() * halfWidth;
+            outline.polygon({a + n, b + n, b - n, a - n});
+
+            if (i + 1 < count)
+                addJoin(outline, b, d, (vertices[i + 1] - b).unit(), halfWidth, stroke, tol);
+        }
+
+        if (contour.closed) {
+            auto dLast = (vertices[count - 1] - vertices[count - 2]).unit();
+            auto dFirst = (vertices[1] - vertices[0]).unit();
+            addJoin(outline, vertices[0], dLast, dFirst, halfWidth, stroke, tol);
+        }
+        else {
+            addCap(outline, vertices[0], (vertices[0] - vertices[1]).unit(), halfWidth, stroke.lineCap, tol);
+            addCap(outline, vertices[count - 1], (vertices[count - 1] - vertices[count - 2]).unit(),
+                   halfWidth, stroke.lineCap, tol);
+        }
+    }
+
+    return result;
+}
+
+/*****************************************************************************/
+
+bool
+TessellationCache::Key::operator<(const Key& rhs) const
+{
+    if (path != rhs.path) return path < rhs.path;
+    if (scaleBucket != rhs.scaleBucket) return scaleBucket < rhs.scaleBucket;
+    if (tolerance != rhs.tolerance) return tolerance < rhs.tolerance;
+    return stroke < rhs.stroke;
+}
+
+/**
+ * Transforms that differ only by translation, or by a small change in scale, share an entry.
+ * The geometry is built for the largest scale in the bucket so the tolerance is still honored.
+ */
+static int
+scaleBucket(const Transform2D& transform)
+{
+    return static_cast<int>(std::ceil(std::log2(transformScale(transform)) * SCALE_BUCKETS_PER_OCTAVE));
+}
+
+static Transform2D
+bucketTransform(int bucket)
+{
+    return Transform2D::scale(std::exp2(static_cast<float>(bucket) / SCALE_BUCKETS_PER_OCTAVE));
+}
+
+ContoursPtr
+TessellationCache::fill(const PathPtr& path, const Transform2D& transform, float tolerance)
+{
+    if (!path)
+        return nullptr;
+
+    auto bucket = scaleBucket(transform);
+    return lookup(path, Key{path.get(), bucket, tolerance, {}}, [&]() {
+        return flattenPath(*path, bucketTransform(bucket), tolerance);
+    });
+}
+
+ContoursPtr
+TessellationCache::stroke(const PathPtr& path, const StrokePathOp& stroke, const Transform2D& transform,
+                          float tolerance)
+{
+    if (!path)
+        return nullptr;
+
+    auto bucket = scaleBucket(transform);
+    std::vector<float> strokeKey = {stroke.strokeWidth, stroke.miterLimit, stroke.pathLength,
+                                    stroke.dashOffset, static_cast<float>(stroke.lineCap),
+                                    static_cast<float>(stroke.lineJoin)};
+    strokeKey.insert(strokeKey.end(), stroke.dashes.begin(), stroke.dashes.end());
+
+    return lookup(path, Key{path.get(), bucket, tolerance, std::move(strokeKey)}, [&]() {
+        auto t = bucketTransform(bucket);
+        return strokeContours(flattenPath(*path, t, tolerance), stroke, t, tolerance);
+    });
+}
+
+ContoursPtr
+TessellationCache::lookup(const PathPtr& path, Key&& key, const std::function<Contours()>& build)
+{
+    auto it = mEntries.find(key);
+    if (it != mEntries.end()) {
+        auto& entry = it->second;
+        if (entry.path.lock() == path && entry.generation == path->generation()) {
+            mHits++;
+            mLRU.splice(mLRU.begin(), mLRU, entry.lru);
+            return entry.contours;
+        }
+
+        // The path was modified or the address was reused by a new path
+        mLRU.erase(entry.lru);
+        mEntries.erase(it);
+    }
+
+    mMisses++;
+    auto contours = std::make_shared<const Contours>(build());
+
+    mLRU.emplace_front(key);
+    mEntries.emplace(std::move(key), Entry{path, path->generation(), contours, mLRU.begin()});
+
+    while (mEntries.size() > mMaxEntries) {
+        mEntries.erase(mLRU.back());
+        mLRU.pop_back();
+    }
+
+    return contours;
+}
+
+void
+TessellationCache::clean()
+{
+    auto it = mEntries.begin();
+    while (it != mEntries.end()) {
+        if (it->second.path.expired()) {
+            mLRU.erase(it->second.lru);
+            it = mEntries.erase(it);
+        }
+        else {
+            it++;
+        }
+    }
+}
+
+void
+TessellationCache::clear()
+{
+    mEntries.clear();
+    mLRU.clear();
+}
+
+} // namespace sg
+} // namespace apl
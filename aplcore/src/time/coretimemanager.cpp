@@ -13,9 +13,6 @@
  * permissions and limitations under the License.
  */
 
-#include <algorithm>
-#include <iterator>
-
 #include "apl/time/coretimemanager.h"
 #include "apl/utils/log.h"
 
@@ -29,8 +26,7 @@ CoreTimeManager::setTimeout(Runnable func, apl_duration_t delay)
     LOG_IF(DEBUG_CORE_TIME) << "id=" << mNextId << " delay=" << delay;
 
     timeout_id id = mNextId++;
-    mTimerHeap.emplace_back(TimeoutTuple(func, nullptr, mTime, delay, id));
-    std::push_heap(mTimerHeap.begin(), mTimerHeap.end());
+    mTimers->push(TimerQueueEntry(std::move(func), TimerQueueEntry::NO_SLOT, mTime, delay, id));
     return id;
 }
 
@@ -40,8 +36,8 @@ CoreTimeManager::setAnimator(Animator animator, apl_duration_t delay)
     LOG_IF(DEBUG_CORE_TIME) << "id=" << mNextId << " delay=" << delay;
 
     timeout_id id = mNextId++;
-    mTimerHeap.emplace_back(TimeoutTuple(nullptr, animator, mTime, delay, id));
-    std::push_heap(mTimerHeap.begin(), mTimerHeap.end());
+    auto slot = acquireSlot(std::move(animator), id, mTime);
+    mTimers->push(TimerQueueEntry(nullptr, slot, mTime, delay, id));
     mAnimatorCount++;
     return id;
 }
@@ -51,31 +47,28 @@ CoreTimeManager::clearTimeout(timeout_id id)
 {
     LOG_IF(DEBUG_CORE_TIME) << "id=" << id;
 
-    for (auto it = mTimerHeap.begin(); it != mTimerHeap.end(); it++) {
-        if (it->id == id) {
-            if (it->animator)
-                mAnimatorCount--;
-            it = mTimerHeap.erase(it);
-            std::make_heap(mTimerHeap.begin(), mTimerHeap.end());
-            return true;
-        }
-    }
+    TimerQueueEntry entry;
+    if (!mTimers->remove(id, &entry))
+        return false;
 
-    return false;
+    if (entry.slot != TimerQueueEntry::NO_SLOT) {
+        releaseSlot(entry.slot);
+        mAnimatorCount--;
+    }
+    return true;
 }
 
 void
 CoreTimeManager::freeze(timeout_id id)
 {
     LOG_IF(DEBUG_CORE_TIME) << "id=" << id;
-    auto it = mTimerHeap.begin();
-    while (it != mTimerHeap.end()) {
-        if (it->id == id) {
-            mFrozen.emplace(id, std::move(*it));
-            it = mTimerHeap.erase(it);
-        } else
-            it++;
-    }
+    TimerQueueEntry entry;
+    if (!mTimers->remove(id, &entry))
+        return;
+
+    if (entry.slot != TimerQueueEntry::NO_SLOT)
+        mAnimators[entry.slot].active = false;
+    mFrozen.emplace(id, std::move(entry));
 }
 
 bool
@@ -84,13 +77,13 @@ CoreTimeManager::rehydrate(timeout_id id)
     LOG_IF(DEBUG_CORE_TIME) << "id=" << id;
     auto it = mFrozen.find(id);
     if (it == mFrozen.end()) return false;
-    if (it->second.animator) {
+    if (it->second.slot != TimerQueueEntry::NO_SLOT) {
+        mAnimators[it->second.slot].active = true;
         mAnimatorCount++;
     }
 
-    mTimerHeap.emplace_back(std::move(it->second));
-    std::push_heap(mTimerHeap.begin(), mTimerHeap.end());
-    mFrozen.erase(id);
+    mTimers->push(std::move(it->second));
+    mFrozen.erase(it);
 
     return true;
 }
@@ -111,21 +104,34 @@ CoreTimeManager::updateTime(apl_time_t updatedTime)
         return;
     }
 
-    while (!mTimerHeap.empty() && mTimerHeap.begin()->endTime <= updatedTime)
+    while (mTimers->size() && mTimers->nextTime() <= updatedTime)
         advanceToNext();
 
     mTime = updatedTime;
 
-    // Collect active (i.e. not completed) animators
-    std::vector<TimeoutTuple> animators;
-    animators.reserve(mAnimatorCount);
-    std::copy_if(mTimerHeap.begin(), mTimerHeap.end(), std::back_inserter(animators),
-                 [](TimeoutTuple m) { return m.animator; });
+    if (mAnimatorCount <= 0 || mTicking)
+        return;
+
+    // Take a snapshot of the active (i.e. not completed) animators.  Running an animator can add
+    // or clear animators; new ones wait for the next tick and cleared ones are skipped.
+    mTickEntries.clear();
+    for (size_t slot = 0 ; slot < mAnimators.size() ; slot++) {
+        const auto& entry = mAnimators[slot];
+        if (entry.active)
+            mTickEntries.emplace_back(TickEntry{slot, entry.id});
+    }
 
-    // Run animators outside timer heap iteration since running animators can mutate the heap
-    for (auto &m : animators) {
-        m.animator(mTime - m.startTime);
+    mTicking = true;
+    for (const auto& tick : mTickEntries) {
+        auto& entry = mAnimators[tick.slot];
+        if (entry.active && entry.id == tick.id && entry.animator)
+            entry.animator(mTime - entry.startTime);
     }
+    mTicking = false;
+
+    for (auto slot : mReleasedSlots)
+        releaseSlot(slot);
+    mReleasedSlots.clear();
 }
 
 apl_time_t
@@ -134,23 +140,25 @@ CoreTimeManager::nextTimeout()
     if (mAnimatorCount > 0)
         return mTime + 1;
 
-    if (mTimerHeap.size())
-        return mTimerHeap.at(0).endTime;
-
-    return std::numeric_limits<apl_time_t>::max();
+    return mTimers->nextTime();
 }
 
 void
 CoreTimeManager::runPending()
 {
-    while (mTimerHeap.size() && mTimerHeap.begin()->endTime <= mTime)
+    while (mTimers->size() && mTimers->nextTime() <= mTime)
         advanceToNext();
 }
 
 void
 CoreTimeManager::clear()
 {
-    mTimerHeap.clear();
+    mTimers->forEach([this](const TimerQueueEntry& entry) {
+        if (entry.slot != TimerQueueEntry::NO_SLOT)
+            releaseSlot(entry.slot);
+    });
+
+    mTimers->clear();
     mAnimatorCount = 0;
 }
 
@@ -169,22 +177,61 @@ CoreTimeManager::isTerminated()
 
 void CoreTimeManager::advanceToNext()
 {
-    std::pop_heap(mTimerHeap.begin(), mTimerHeap.end());  // Move to end
-    TimeoutTuple tt = mTimerHeap.back();  // Grab the last element
-    mTimerHeap.pop_back();  // Remove the last element
+    auto tt = mTimers->pop();  // Remove the earliest timeout
     mTime = tt.endTime;   // Advance the clock
     if (tt.runnable) {
         LOG_IF(DEBUG_CORE_TIME) << "Executing the runnable";
         tt.runnable();  // Execute the runnable
     }
-    else if (tt.animator) {
+    else if (tt.slot != TimerQueueEntry::NO_SLOT) {
         LOG_IF(DEBUG_CORE_TIME) << "Executing the animator";
-        tt.animator(tt.endTime - tt.startTime);
+        auto& animator = mAnimators[tt.slot].animator;
+        if (animator)
+            animator(tt.endTime - tt.startTime);
         mAnimatorCount--;
+        releaseSlot(tt.slot);
     }
     else {
         LOG(LogLevel::kError) << "No animator or runnable defined";
     }
 }
 
+size_t
+CoreTimeManager::acquireSlot(Animator&& animator, timeout_id id, apl_time_t startTime)
+{
+    size_t slot;
+    if (mFreeSlots.empty()) {
+        slot = mAnimators.size();
+        mAnimators.emplace_back();
+    } else {
+        slot = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    }
+
+    auto& entry = mAnimators[slot];
+    entry.animator = std::move(animator);
+    entry.startTime = startTime;
+    entry.id = id;
+    entry.active = true;
+    return slot;
+}
+
+void
+CoreTimeManager::releaseSlot(size_t slot)
+{
+    auto& entry = mAnimators[slot];
+
+    // The animator may be the one that is running.  Hold on to it until the tick is done.
+    if (mTicking) {
+        entry.active = false;
+        mReleasedSlots.emplace_back(slot);
+        return;
+    }
+
+    entry.animator = nullptr;
+    entry.id = 0;
+    entry.active = false;
+    mFreeSlots.emplace_back(slot);
+}
+
 } // namespace apl
@@ -0,0 +1,78 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "apl/time/timerqueue.h"
+
+namespace apl {
+
+const size_t TimerQueueEntry::NO_SLOT;
+
+// The standard heap functions keep the largest element on top.  Reverse the order deliberately.
+static bool
+laterEnd(const TimerQueueEntry& lhs, const TimerQueueEntry& rhs)
+{
+    return lhs.endTime > rhs.endTime;
+}
+
+void
+HeapTimerQueue::push(TimerQueueEntry&& entry)
+{
+    mHeap.emplace_back(std::move(entry));
+    std::push_heap(mHeap.begin(), mHeap.end(), laterEnd);
+}
+
+bool
+HeapTimerQueue::remove(timeout_id id, TimerQueueEntry *removed)
+{
+    auto it = std::find_if(mHeap.begin(), mHeap.end(), [id](const TimerQueueEntry& entry) {
+        return entry.id == id;
+    });
+    if (it == mHeap.end())
+        return false;
+
+    if (removed)
+        *removed = std::move(*it);
+    mHeap.erase(it);
+    std::make_heap(mHeap.begin(), mHeap.end(), laterEnd);
+    return true;
+}
+
+apl_time_t
+HeapTimerQueue::nextTime()
+{
+    if (mHeap.empty())
+        return std::numeric_limits<apl_time_t>::max();
+    return mHeap.front().endTime;
+}
+
+TimerQueueEntry
+HeapTimerQueue::pop()
+{
+    std::pop_heap(mHeap.begin(), mHeap.end(), laterEnd);  // Move to end
+    TimerQueueEntry entry = std::move(mHeap.back());
+    mHeap.pop_back();
+    return entry;
+}
+
+void
+HeapTimerQueue::forEach(const std::function<void(const TimerQueueEntry&)>& func) const
+{
+    for (const auto& entry : mHeap)
+        func(entry);
+}
+
+} // namespace apl
@@ -0,0 +1,255 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "apl/time/timerwheel.h"
+
+namespace apl {
+
+// Timeouts further out than this are treated as ending at this time.  They still leave in order.
+static const std::int64_t MAX_TICK = static_cast<std::int64_t>(1) << 62;
+
+const size_t TimerWheel::OVERFLOW_BUCKET;
+const size_t TimerWheel::NONE;
+
+TimerWheel::TimerWheel()
+    : mHeads(OVERFLOW_BUCKET + 1, NONE)
+{
+    std::fill(std::begin(mOccupied), std::end(mOccupied), 0);
+}
+
+void
+TimerWheel::push(TimerQueueEntry&& entry)
+{
+    size_t node;
+    if (mFreeNodes.empty()) {
+        node = mNodes.size();
+        mNodes.emplace_back();
+    } else {
+        node = mFreeNodes.back();
+        mFreeNodes.pop_back();
+    }
+
+    auto& n = mNodes[node];
+    n.entry = std::move(entry);
+    n.sequence = mSequence++;
+    mIndex[n.entry.id] = node;
+    place(node);
+}
+
+bool
+TimerWheel::remove(timeout_id id, TimerQueueEntry *removed)
+{
+    auto it = mIndex.find(id);
+    if (it == mIndex.end())
+        return false;
+
+    take(it->second, removed);
+    return true;
+}
+
+apl_time_t
+TimerWheel::nextTime()
+{
+    auto bucket = earliestBucket();
+    if (bucket == NONE)
+        return std::numeric_limits<apl_time_t>::max();
+    return mNodes[earliestIn(bucket)].entry.endTime;
+}
+
+TimerQueueEntry
+TimerWheel::pop()
+{
+    auto bucket = earliestBucket();
+    assert(bucket != NONE);
+
+    // Every timeout in a first-level bucket ends within the same millisecond
+    auto node = earliestIn(bucket);
+    mCurrent = tickOf(mNodes[node]);
+
+    TimerQueueEntry entry;
+    take(node, &entry);
+    return entry;
+}
+
+void
+TimerWheel::forEach(const std::function<void(const TimerQueueEntry&)>& func) const
+{
+    for (const auto& m : mIndex)
+        func(mNodes[m.second].entry);
+}
+
+void
+TimerWheel::clear()
+{
+    mNodes.clear();
+    mFreeNodes.clear();
+    std::fill(mHeads.begin(), mHeads.end(), NONE);
+    std::fill(std::begin(mOccupied), std::end(mOccupied), 0);
+    mIndex.clear();
+}
+
+std::int64_t
+TimerWheel::tickOf(const Node& node) const
+{
+    auto end = std::floor(node.entry.endTime);
+    if (!(end < static_cast<double>(MAX_TICK)))
+        return MAX_TICK;
+
+    // A timeout that should already have fired (for example, a rehydrated one) is due now
+    return std::max(static_cast<std::int64_t>(end), mCurrent);
+}
+
+void
+TimerWheel::place(size_t node)
+{
+    auto tick = tickOf(mNodes[node]);
+    auto diff = static_cast<std::uint64_t>(tick ^ mCurrent);
+
+    for (int level = 0 ; level < LEVELS ; level++) {
+        auto shift = SLOT_BITS * level;
+        if ((diff >> (shift + SLOT_BITS)) == 0) {
+            auto slot = static_cast<size_t>((tick >> shift) & (SLOTS - 1));
+            link(node, level * SLOTS + slot);
+            return;
+        }
+    }
+
+    link(node, OVERFLOW_BUCKET);
+}
+
+void
+TimerWheel::link(size_t node, size_t bucket)
+{
+    auto& n = mNodes[node];
+    n.bucket = bucket;
+    n.prev = NONE;
+    n.next = mHeads[bucket];
+    if (n.next != NONE)
+        mNodes[n.next].prev = node;
+    mHeads[bucket] = node;
+
+    if (bucket != OVERFLOW_BUCKET)
+        mOccupied[bucket / SLOTS] |= static_cast<std::uint64_t>(1) << (bucket % SLOTS);
+}
+
+void
+TimerWheel::unlink(size_t node)
+{
+    auto& n = mNodes[node];
+    if (n.prev != NONE)
+        mNodes[n.prev].next = n.next;
+    else
+        mHeads[n.bucket] = n.next;
+
+    if (n.next != NONE)
+        mNodes[n.next].prev = n.prev;
+
+    if (mHeads[n.bucket] == NONE && n.bucket != OVERFLOW_BUCKET)
+        mOccupied[n.bucket / SLOTS] &= ~(static_cast<std::uint64_t>(1) << (n.bucket % SLOTS));
+
+    n.bucket = NONE;
+    n.prev = NONE;
+    n.next = NONE;
+}
+
+void
+TimerWheel::spread(size_t bucket)
+{
+    auto node = mHeads[bucket];
+    mHeads[bucket] = NONE;
+    if (bucket != OVERFLOW_BUCKET)
+        mOccupied[bucket / SLOTS] &= ~(static_cast<std::uint64_t>(1) << (bucket % SLOTS));
+
+    while (node != NONE) {
+        auto next = mNodes[node].next;
+        place(node);
+        node = next;
+    }
+}
+
+size_t
+TimerWheel::earliestBucket()
+{
+    while (!mIndex.empty()) {
+        auto spreadBucket = NONE;
+
+        for (int level = 0 ; level < LEVELS && spreadBucket == NONE ; level++) {
+            auto shift = SLOT_BITS * level;
+            auto current = static_cast<int>((mCurrent >> shift) & (SLOTS - 1));
+
+            // The bucket under the wheel position is only used in the first level
+            for (int slot = level == 0 ? current : current + 1 ; slot < SLOTS ; slot++) {
+                if ((mOccupied[level] & (static_cast<std::uint64_t>(1) << slot)) == 0)
+                    continue;
+
+                if (level == 0)
+                    return slot;
+
+                // Move to the start of the bucket and spread it over the lower levels
+                auto span = shift + SLOT_BITS;
+                mCurrent = ((mCurrent >> span) << span) | (static_cast<std::int64_t>(slot) << shift);
+                spreadBucket = level * SLOTS + slot;
+                break;
+            }
+        }
+
+        // Only the overflow list is left.  Move to its earliest timeout.
+        if (spreadBucket == NONE) {
+            auto earliest = MAX_TICK;
+            for (auto node = mHeads[OVERFLOW_BUCKET] ; node != NONE ; node = mNodes[node].next)
+                earliest = std::min(earliest, tickOf(mNodes[node]));
+            mCurrent = earliest;
+            spreadBucket = OVERFLOW_BUCKET;
+        }
+
+        spread(spreadBucket);
+    }
+
+    return NONE;
+}
+
+size_t
+TimerWheel::earliestIn(size_t bucket) const
+{
+    auto best = mHeads[bucket];
+    for (auto node = mNodes[best].next ; node != NONE ; node = mNodes[node].next) {
+        const auto& n = mNodes[node];
+        const auto& b = mNodes[best];
+        if (n.entry.endTime < b.entry.endTime ||
+            (n.entry.endTime == b.entry.endTime && n.sequence < b.sequence))
+            best = node;
+    }
+    return best;
+}
+
+void
+TimerWheel::take(size_t node, TimerQueueEntry *removed)
+{
+    unlink(node);
+
+    auto& entry = mNodes[node].entry;
+    mIndex.erase(entry.id);
+    if (removed)
+        *removed = std::move(entry);
+    entry = TimerQueueEntry();
+
+    mFreeNodes.emplace_back(node);
+}
+
+} // namespace apl
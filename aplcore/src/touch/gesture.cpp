@@ -111,6 +111,13 @@ Gesture::consume(const PointerEvent& event, apl_time_t timestamp)
     return mTriggered;
 }
 
+void
+Gesture::track(const PointerEvent& event, apl_time_t timestamp)
+{
+    if (mStarted && event.pointerEventType == PointerEventType::kPointerMove)
+        onTrack(event, timestamp);
+}
+
 void
 Gesture::passPointerEventThrough(const PointerEvent& event)
 {
@@ -49,6 +49,12 @@ FlingGesture::onMove(const PointerEvent& event, apl_time_t timestamp)
     return true;
 }
 
+void
+FlingGesture::onTrack(const PointerEvent& event, apl_time_t timestamp)
+{
+    mVelocityTracker->addPointerEvent(event, timestamp);
+}
+
 bool
 FlingGesture::onDown(const PointerEvent& event, apl_time_t timestamp)
 {
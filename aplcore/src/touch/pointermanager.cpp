@@ -15,6 +15,7 @@
 
 #include "apl/touch/pointermanager.h"
 
+#include "apl/component/actionablecomponent.h"
 #include "apl/component/corecomponent.h"
 #include "apl/component/touchablecomponent.h"
 #include "apl/engine/corerootcontext.h"
@@ -64,6 +65,18 @@ Bimap<PointerEventType, PropertyKey> sEventHandlers = {{kPointerCancel, kPropert
                                                        {kPointerMove, kPropertyOnMove},
                                                        {kPointerUp, kPropertyOnUp}};
 
+/*
+ * A move is coalesced when the next event is a move of the same pointer.
+ */
+static inline bool
+isCoalesced(const PointerSample& sample, const PointerSample& next)
+{
+    return sample.event.pointerEventType == kPointerMove &&
+           next.event.pointerEventType == kPointerMove &&
+           sample.event.pointerId == next.event.pointerId &&
+           sample.event.pointerType == next.event.pointerType;
+}
+
 PointerManager::PointerManager(const CoreRootContext& core, HoverManager& hover) :
       mCore(core), mHoverManager(hover)
 {}
@@ -193,6 +206,46 @@ PointerManager::handlePointerEvent(const PointerEvent& pointerEvent, apl_time_t
     return pointer->isCaptured();
 }
 
+bool
+PointerManager::handlePointerEvents(const std::vector<PointerSample>& samples)
+{
+    bool consumed = false;
+    for (size_t i = 0 ; i < samples.size() ; i++) {
+        const auto& sample = samples.at(i);
+        if (i + 1 < samples.size() && isCoalesced(sample, samples.at(i + 1)))
+            handlePointerHistory(sample.event, sample.timestamp);
+        else
+            consumed = handlePointerEvent(sample.event, sample.timestamp) || consumed;
+    }
+    return consumed;
+}
+
+void
+PointerManager::handlePointerHistory(const PointerEvent& pointerEvent, apl_time_t timestamp)
+{
+    // A pointer that is not down has no gestures in progress
+    if (!mActivePointer || pointerEvent.pointerId != mActivePointer->getId())
+        return;
+
+    auto target = mActivePointer->getTarget();
+    if (!target)
+        return;
+
+    if (mActivePointer->isCaptured()) {
+        target->processPointerHistory(pointerEvent, timestamp);
+        return;
+    }
+
+    auto hitListIt = HitListIterator(target);
+    while (true) {
+        auto hitTarget = hitListIt.next();
+        if (!hitTarget.ptr) break;
+        auto actionable = ActionableComponent::cast(hitTarget.ptr);
+        if (actionable)
+            actionable->processPointerHistory(pointerEvent, timestamp);
+    }
+}
+
 void
 PointerManager::handleTimeUpdate(apl_time_t timestamp)
 {
@@ -230,7 +283,7 @@ PointerManager::handlePointerStart(const std::shared_ptr<Pointer>& pointer,
         return nullptr;
 
     auto visitor = TouchableAtPosition(pointerEvent.pointerEventPosition);
-    top->raccept(visitor);
+    top->rsearch(visitor);
     auto target = ActionableComponent::cast(visitor.getResult());
 
     pointer->setTarget(target);
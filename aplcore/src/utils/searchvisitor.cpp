@@ -40,11 +40,13 @@ SearchVisitor::visit(const CoreComponent& component) {
                                    << " point=" << pointInCurrent.toString()
                                    << " scrollPosition=" << component.scrollPosition();
 
-    if (!universalCondition(component, pointInCurrent)) {
+    if (!component.containsLocalPosition(pointInCurrent) || !universalCondition(component, pointInCurrent)) {
         mPruneBranch = true;
         return;
     }
 
+    mLocalPoint = pointInCurrent;
+
     if (spotCondition(component, pointInCurrent)) {
         // if the component satisfies the spot condition, cache it as a potential result so we can avoid a stack
         mPotentialResult =
@@ -88,8 +90,7 @@ SearchVisitor::getResult() const {
 bool
 TouchableAtPosition::universalCondition(const CoreComponent& component,
                                         const Point& pointInCurrent) {
-    return component.containsLocalPosition(pointInCurrent)
-           && component.getCalculated(kPropertyDisplay).asInt() == kDisplayNormal
+    return component.getCalculated(kPropertyDisplay).asInt() == kDisplayNormal
            && component.getCalculated(kPropertyOpacity).asNumber() > 0.0;
 }
 
@@ -104,8 +105,7 @@ TouchableAtPosition::spotCondition(const CoreComponent& component, const Point&
 
 bool
 TopAtPosition::universalCondition(const CoreComponent& component, const Point& pointInCurrent) {
-    return component.containsLocalPosition(pointInCurrent)
-           && component.getCalculated(kPropertyDisplay).asInt() == kDisplayNormal
+    return component.getCalculated(kPropertyDisplay).asInt() == kDisplayNormal
            && component.getCalculated(kPropertyOpacity).asNumber() > 0.0;
 }
 }
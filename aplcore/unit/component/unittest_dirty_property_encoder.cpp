@@ -0,0 +1,202 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+#include "apl/component/dirtypropertydecoder.h"
+#include "apl/component/dirtypropertyencoder.h"
+
+using namespace apl;
+
+class DirtyPropertyEncoderTest : public DocumentWrapper {
+public:
+    /**
+     * Decode a frame into a map of unique id -> property key -> value
+     */
+    static std::map<std::string, std::map<int, DirtyValue>> decode(const std::vector<uint8_t>& buffer) {
+        std::map<std::string, std::map<int, DirtyValue>> result;
+        DirtyPropertyDecoder decoder(buffer);
+        std::string uid;
+        uint32_t count;
+        while (decoder.nextComponent(uid, count)) {
+            auto& properties = result[uid];
+            int key;
+            DirtyValue value;
+            for (uint32_t i = 0 ; i < count ; i++) {
+                EXPECT_TRUE(decoder.nextProperty(key, value));
+                properties.emplace(key, value);
+            }
+        }
+        EXPECT_FALSE(decoder.failed());
+        EXPECT_EQ(decoder.componentCount(), result.size());
+        return result;
+    }
+
+    DirtyPropertyEncoder encoder;
+};
+
+static const char *DIRTY_DOC = R"apl({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Container",
+      "items": [
+        {
+          "type": "Frame",
+          "id": "FRAME",
+          "width": 100,
+          "height": 100,
+          "backgroundColor": "red"
+        },
+        {
+          "type": "Text",
+          "id": "TEXT",
+          "text": "Hello"
+        }
+      ]
+    }
+  }
+})apl";
+
+TEST_F(DirtyPropertyEncoderTest, Empty)
+{
+    loadDocument(DIRTY_DOC);
+
+    auto& buffer = encoder.encode(root->getDirty());
+    auto result = decode(buffer);
+    ASSERT_TRUE(result.empty());
+    ASSERT_EQ(&buffer, &encoder.buffer());
+}
+
+TEST_F(DirtyPropertyEncoderTest, TypedValues)
+{
+    loadDocument(DIRTY_DOC);
+
+    auto frame = CoreComponent::cast(root->findComponentById("FRAME"));
+    auto text = CoreComponent::cast(root->findComponentById("TEXT"));
+
+    executeCommand("SetValue", {{"componentId", "FRAME"}, {"property", "backgroundColor"}, {"value", "blue"}}, true);
+    executeCommand("SetValue", {{"componentId", "FRAME"}, {"property", "transform"},
+                                {"value", Object(ObjectArray{
+                                    Object(std::make_shared<ObjectMap>(ObjectMap{{"translateX", 10}}))})}}, true);
+    executeCommand("SetValue", {{"componentId", "FRAME"}, {"property", "opacity"}, {"value", 0.5}}, true);
+    executeCommand("SetValue", {{"componentId", "TEXT"}, {"property", "text"},
+                                {"value", "Hi <b>there</b> <span color='red'>x</span>"}}, true);
+    executeCommand("SetValue", {{"componentId", "TEXT"}, {"property", "width"}, {"value", 200}}, true);
+
+    auto dirty = root->getDirty();
+    auto result = decode(encoder.encode(dirty));
+    ASSERT_EQ(dirty.size(), result.size());
+
+    // Every dirty property of every component is present
+    for (const auto& component : dirty) {
+        auto& properties = result.at(component->getUniqueId());
+        ASSERT_EQ(component->getDirty().size(), properties.size());
+        for (const auto& key : component->getDirty())
+            ASSERT_EQ(1, properties.count(key));
+    }
+
+    auto& frameProperties = result.at(frame->getUniqueId());
+    auto& color = frameProperties.at(kPropertyBackgroundColor);
+    ASSERT_EQ(kDirtyValueColor, color.type);
+    ASSERT_EQ(Color::BLUE, color.color);
+
+    auto& opacity = frameProperties.at(kPropertyOpacity);
+    ASSERT_EQ(kDirtyValueNumber, opacity.type);
+    ASSERT_EQ(0.5, opacity.number);
+
+    auto& transform = frameProperties.at(kPropertyTransform);
+    ASSERT_EQ(kDirtyValueTransform2D, transform.type);
+    auto expected = frame->getCalculated(kPropertyTransform).get<Transform2D>().get();
+    for (int i = 0 ; i < 6 ; i++)
+        ASSERT_EQ(expected[i], transform.data[i]);
+
+    auto& textProperties = result.at(text->getUniqueId());
+    auto& styled = textProperties.at(kPropertyText);
+    ASSERT_EQ(kDirtyValueStyledText, styled.type);
+    ASSERT_EQ("Hi there x", styled.string);
+    ASSERT_EQ(2, styled.spans.size());
+    ASSERT_EQ(StyledText::kSpanTypeStrong, styled.spans[0].type);
+    ASSERT_EQ(3, styled.spans[0].start);
+    ASSERT_EQ(8, styled.spans[0].end);
+    ASSERT_EQ(StyledText::kSpanTypeSpan, styled.spans[1].type);
+    ASSERT_EQ(1, styled.spans[1].attributes.size());
+    ASSERT_EQ(StyledText::kSpanAttributeNameColor, styled.spans[1].attributes[0].name);
+    ASSERT_EQ(kDirtyValueColor, styled.spans[1].attributes[0].type);
+    ASSERT_EQ(Color::RED, styled.spans[1].attributes[0].color);
+
+    auto& bounds = textProperties.at(kPropertyBounds);
+    ASSERT_EQ(kDirtyValueRect, bounds.type);
+    auto rect = text->getCalculated(kPropertyBounds).get<Rect>();
+    ASSERT_EQ(rect.getX(), bounds.data[0]);
+    ASSERT_EQ(rect.getY(), bounds.data[1]);
+    ASSERT_EQ(200, bounds.data[2]);
+    ASSERT_EQ(rect.getHeight(), bounds.data[3]);
+
+    // Encoding does not clear the dirty flags
+    ASSERT_FALSE(root->getDirty().empty());
+    root->clearDirty();
+}
+
+TEST_F(DirtyPropertyEncoderTest, JsonFallback)
+{
+    loadDocument(DIRTY_DOC);
+
+    executeCommand("SetValue", {{"componentId", "FRAME"}, {"property", "accessibilityLabel"}, {"value", "Label"}}, true);
+    executeCommand("SetValue", {{"componentId", "FRAME"}, {"property", "borderRadius"}, {"value", 5}}, true);
+
+    auto frame = root->findComponentById("FRAME");
+    auto result = decode(encoder.encode(root->getDirty()));
+    auto& properties = result.at(frame->getUniqueId());
+
+    auto& label = properties.at(kPropertyAccessibilityLabel);
+    ASSERT_EQ(kDirtyValueString, label.type);
+    ASSERT_EQ("Label", label.string);
+
+    // Radii have no native encoding and are written as JSON
+    auto& radii = properties.at(kPropertyBorderRadii);
+    ASSERT_EQ(kDirtyValueJson, radii.type);
+    ASSERT_EQ("[5.0,5.0,5.0,5.0]", radii.string);
+
+    root->clearDirty();
+}
+
+TEST_F(DirtyPropertyEncoderTest, Malformed)
+{
+    loadDocument(DIRTY_DOC);
+    executeCommand("SetValue", {{"componentId", "FRAME"}, {"property", "opacity"}, {"value", 0.5}}, true);
+
+    auto buffer = encoder.encode(root->getDirty());
+    root->clearDirty();
+
+    // Truncating the frame anywhere must fail cleanly
+    for (size_t len = 0 ; len < buffer.size() ; len++) {
+        DirtyPropertyDecoder decoder(buffer.data(), len);
+        std::string uid;
+        uint32_t count;
+        int key;
+        DirtyValue value;
+        while (decoder.nextComponent(uid, count))
+            while (decoder.nextProperty(key, value))
+                ;
+        ASSERT_TRUE(decoder.failed()) << len;
+    }
+
+    // A bad magic number is rejected
+    buffer[0] ^= 0xff;
+    DirtyPropertyDecoder decoder(buffer);
+    ASSERT_TRUE(decoder.failed());
+}
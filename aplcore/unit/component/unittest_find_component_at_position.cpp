@@ -480,3 +480,149 @@ TEST_F(FindComponentAtPosition, AbsolutePositionedPager)
     foundComponent = visitor.getResult();
     ASSERT_EQ(tw->getUniqueId(), foundComponent->getUniqueId());
 }
+
+static const char *MANY_CHILDREN = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Container",
+      "width": 100,
+      "height": 400,
+      "data": "${Array.range(40)}",
+      "items": {
+        "type": "Frame",
+        "id": "frame${data}",
+        "width": 100,
+        "height": 10
+      },
+      "lastItem": {
+        "type": "Frame",
+        "id": "cover",
+        "position": "absolute",
+        "left": 0,
+        "top": 0,
+        "width": 50,
+        "height": 50
+      }
+    }
+  }
+})";
+
+/**
+ * Components with many children use an index to find the children under the point
+ */
+TEST_F(FindComponentAtPosition, ManyChildren)
+{
+    loadDocument(MANY_CHILDREN);
+    ASSERT_TRUE(component);
+    ASSERT_EQ(41, component->getChildCount());
+
+    ASSERT_EQ(component->findComponentById("frame1"), component->findComponentAtPosition(Point(75, 15)));
+    ASSERT_EQ(component->findComponentById("cover"), component->findComponentAtPosition(Point(25, 15)));
+    ASSERT_EQ(component->findComponentById("frame39"), component->findComponentAtPosition(Point(50, 395)));
+    ASSERT_EQ(component->findComponentById("frame20"), component->findComponentAtPosition(Point(100, 200)));
+    ASSERT_EQ(nullptr, component->findComponentAtPosition(Point(101, 200)));
+
+    // Hidden children are skipped
+    auto frame = CoreComponent::cast(component->findComponentById("frame10"));
+    frame->setProperty(kPropertyOpacity, 0);
+    ASSERT_EQ(component, component->findComponentAtPosition(Point(75, 105)));
+    frame->setProperty(kPropertyOpacity, 1);
+    ASSERT_EQ(frame, component->findComponentAtPosition(Point(75, 105)));
+
+    // Taking a child out of the layout moves the others up
+    rapidjson::Document doc;
+    doc.Parse(R"([{"type": "SetValue", "componentId": "frame0", "property": "display", "value": "none"}])");
+    rootDocument->executeCommands(doc, false);
+    root->clearPending();
+    ASSERT_EQ(component->findComponentById("frame2"), component->findComponentAtPosition(Point(75, 15)));
+    ASSERT_EQ(component, component->findComponentAtPosition(Point(75, 395)));
+
+    // Moving a child with a transform
+    doc.Parse(R"([{"type": "SetValue", "componentId": "frame30", "property": "transform",
+                   "value": [{"translateY": -200}]}])");
+    rootDocument->executeCommands(doc, false);
+    root->clearPending();
+    ASSERT_EQ(component->findComponentById("frame30"), component->findComponentAtPosition(Point(75, 95)));
+    ASSERT_EQ(component->findComponentById("frame31"), component->findComponentAtPosition(Point(75, 305)));
+    ASSERT_EQ(component, component->findComponentAtPosition(Point(75, 295)));
+}
+
+static const char *MANY_ROTATED = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Container",
+      "width": 400,
+      "height": 400,
+      "data": "${Array.range(30)}",
+      "items": {
+        "type": "TouchWrapper",
+        "position": "absolute",
+        "left": "${(index % 6) * 60}",
+        "top": "${Math.floor(index / 6) * 60}",
+        "width": 80,
+        "height": 20,
+        "transform": [{"rotate": "${index * 17}"}, {"scale": "${1 + (index % 3) / 4}"}]
+      }
+    }
+  }
+})";
+
+/**
+ * The index finds exactly what a walk over all of the children finds
+ */
+TEST_F(FindComponentAtPosition, MatchesFullWalk)
+{
+    loadDocument(MANY_ROTATED);
+    ASSERT_TRUE(component);
+    ASSERT_EQ(30, component->getChildCount());
+
+    int hits = 0;
+    for (int x = -20 ; x <= 420 ; x += 3) {
+        for (int y = -20 ; y <= 420 ; y += 3) {
+            auto indexed = TouchableAtPosition(Point(x, y));
+            component->rsearch(indexed);
+            auto walked = TouchableAtPosition(Point(x, y));
+            component->raccept(walked);
+            ASSERT_EQ(walked.getResult(), indexed.getResult()) << x << "," << y;
+            if (indexed.getResult())
+                hits++;
+        }
+    }
+
+    ASSERT_TRUE(hits > 100);
+}
+
+static const char *LONG_SEQUENCE = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Sequence",
+      "width": 100,
+      "height": 100,
+      "data": "${Array.range(50)}",
+      "items": {
+        "type": "Frame",
+        "id": "item${data}",
+        "width": 100,
+        "height": 20
+      }
+    }
+  }
+})";
+
+TEST_F(FindComponentAtPosition, ScrolledSequence)
+{
+    loadDocument(LONG_SEQUENCE);
+    ASSERT_TRUE(component);
+    ASSERT_EQ(component->findComponentById("item2"), component->findComponentAtPosition(Point(50, 50)));
+
+    component->update(kUpdateScrollPosition, 200);
+    root->clearPending();
+    ASSERT_EQ(component->findComponentById("item10"), component->findComponentAtPosition(Point(50, 10)));
+    ASSERT_EQ(component->findComponentById("item14"), component->findComponentAtPosition(Point(50, 90)));
+}
@@ -13,18 +13,39 @@
  * permissions and limitations under the License.
  */
 
+#include <functional>
 #include <iostream>
 #include <memory>
 
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/prettywriter.h"
+#include "rapidjson/writer.h"
 
 #include "../testeventloop.h"
 #include "../media/testmediaplayerfactory.h"
 
 using namespace apl;
 
+static std::string
+stringify(const rapidjson::Value& value)
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    value.Accept(writer);
+    return buffer.GetString();
+}
+
+static std::string
+stream(const std::function<void(JsonSink&)>& func)
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    JsonWriterSink<rapidjson::Writer<rapidjson::StringBuffer>> sink(writer);
+    func(sink);
+    return buffer.GetString();
+}
+
 class SerializeTest : public DocumentWrapper {
 public:
     SerializeTest() : DocumentWrapper() {
@@ -382,6 +403,32 @@ TEST_F(SerializeTest, Event)
     ASSERT_STREQ("TouchWrapper", json["source"]["source"].GetString());
     ASSERT_EQ(touch->getUniqueId(), json["source"]["uid"].GetString());
     ASSERT_EQ(false, json["source"]["value"].GetBool());
+
+    // The streamed event matches the RapidJSON value byte for byte
+    ASSERT_EQ(stringify(json), stream([&](JsonSink& sink) { event.serialize(sink); }));
+}
+
+TEST_F(SerializeTest, StreamedDOM)
+{
+    loadDocument(SERIALIZE_COMPONENTS);
+
+    for (auto extended : {false, true}) {
+        rapidjson::Document doc;
+        auto expected = stringify(root->serializeDOM(extended, doc.GetAllocator()));
+        auto actual = stream([&](JsonSink& sink) { root->serializeDOM(extended, sink); });
+        ASSERT_EQ(expected, actual) << "extended=" << extended;
+    }
+}
+
+TEST_F(SerializeTest, StreamedVisualContext)
+{
+    loadDocument(SERIALIZE_COMPONENTS);
+
+    auto actual = stream([&](JsonSink& sink) { root->serializeVisualContext(sink); });
+    ASSERT_FALSE(root->isVisualContextDirty());
+
+    rapidjson::Document doc;
+    ASSERT_EQ(stringify(root->serializeVisualContext(doc.GetAllocator())), actual);
 }
 
 const static char * SERIALIZE_ALL = R"({
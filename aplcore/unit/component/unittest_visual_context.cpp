@@ -2785,4 +2785,94 @@ TEST_F(VisualContextTest, DynamicEntitiesDirect)
     ASSERT_TRUE(visualContext["entities"].IsArray());
     ASSERT_EQ(1, visualContext["entities"].GetArray().Size());
     ASSERT_STREQ("", visualContext["entities"][0].GetString());
-}
\ No newline at end of file
+}
+/**
+ * Serializing an unchanged tree reuses the cached subtree fragments and reports the same context.
+ */
+TEST_F(VisualContextTest, CachedSubtreeUnchanged) {
+    loadDocument(SEQUENCE, DATA);
+    ASSERT_EQ(kComponentTypeSequence, component->getType());
+
+    rapidjson::Document previous;
+    previous.CopyFrom(visualContext, previous.GetAllocator());
+
+    serializeVisualContext();
+    ASSERT_TRUE(previous == visualContext);
+
+    // Changing a child drops the cached fragments up to the top component
+    component->update(kUpdateScrollPosition, 100);
+    root->clearPending();
+    ASSERT_TRUE(CheckDirtyVisualContext(root, component));
+
+    serializeVisualContext();
+    ASSERT_FALSE(previous == visualContext);
+    ASSERT_STREQ("item_2", visualContext["children"][0]["id"].GetString());
+    ASSERT_STREQ("1024x40+0-20:0", visualContext["children"][0]["position"].GetString());
+
+    previous.CopyFrom(visualContext, previous.GetAllocator());
+    serializeVisualContext();
+    ASSERT_TRUE(previous == visualContext);
+}
+
+/**
+ * Clearing the dirty flag without serializing must not leave stale fragments behind.
+ */
+TEST_F(VisualContextTest, CachedSubtreeClearedWithoutSerialize) {
+    loadDocument(SEQUENCE, DATA);
+
+    component->update(kUpdateScrollPosition, 100);
+    root->clearPending();
+    root->clearVisualContextDirty();
+
+    serializeVisualContext();
+    ASSERT_EQ(3, visualContext["children"].Size());
+    ASSERT_STREQ("item_2", visualContext["children"][0]["id"].GetString());
+    ASSERT_STREQ("item_4", visualContext["children"][2]["id"].GetString());
+}
+
+TEST_F(VisualContextTest, Delta) {
+    loadDocument(SEQUENCE, DATA);
+
+    auto uid = [&](int index) { return component->getChildAt(index)->getUniqueId(); };
+
+    // The first delta reports everything
+    auto delta = root->serializeVisualContextDelta(vcDoc.GetAllocator());
+    ASSERT_STREQ(component->getUniqueId().c_str(), delta["root"].GetString());
+    ASSERT_EQ(4, delta["updated"].Size());
+    ASSERT_EQ(0, delta["removed"].Size());
+
+    // The top entry lists its children by unique id
+    for (const auto& entry : delta["updated"].GetArray()) {
+        if (entry["uid"] == component->getUniqueId().c_str()) {
+            ASSERT_EQ(3, entry["children"].Size());
+            ASSERT_STREQ(uid(0).c_str(), entry["children"][0].GetString());
+        }
+    }
+
+    // Nothing changed
+    delta = root->serializeVisualContextDelta(vcDoc.GetAllocator());
+    ASSERT_EQ(0, delta["updated"].Size());
+    ASSERT_EQ(0, delta["removed"].Size());
+
+    component->update(kUpdateScrollPosition, 100);
+    root->clearPending();
+    ASSERT_TRUE(root->isVisualContextDirty());
+
+    // Items 0 and 1 scrolled away, 3 and 4 appeared, 2 moved and the sequence itself changed
+    delta = root->serializeVisualContextDelta(vcDoc.GetAllocator());
+    ASSERT_FALSE(root->isVisualContextDirty());
+    ASSERT_EQ(4, delta["updated"].Size());
+    ASSERT_EQ(2, delta["removed"].Size());
+    std::set<std::string> removed;
+    for (const auto& entry : delta["removed"].GetArray())
+        removed.emplace(entry.GetString());
+    ASSERT_EQ(std::set<std::string>({uid(0), uid(1)}), removed);
+
+    // A full serialization also resets the baseline for the next delta
+    component->update(kUpdateScrollPosition, 0);
+    root->clearPending();
+    serializeVisualContext();
+    delta = root->serializeVisualContextDelta(vcDoc.GetAllocator());
+    ASSERT_EQ(0, delta["updated"].Size());
+    ASSERT_EQ(0, delta["removed"].Size());
+}
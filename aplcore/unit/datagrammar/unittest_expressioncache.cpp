@@ -0,0 +1,115 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+#include "apl/datagrammar/bytecode.h"
+
+using namespace apl;
+
+class ExpressionCacheTest : public DocumentWrapper {};
+
+static const char *SEQUENCE = R"apl({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Sequence",
+      "data": "${Array.range(5)}",
+      "items": {
+        "type": "Text",
+        "text": "${data * 2}:${index}"
+      }
+    }
+  }
+})apl";
+
+/**
+ * The items of a sequence share the parsed expression but bind it to their own context
+ */
+TEST_F(ExpressionCacheTest, SharedBetweenItems)
+{
+    loadDocument(SEQUENCE);
+    ASSERT_EQ(5, component->getChildCount());
+
+    for (int i = 0 ; i < 5 ; i++)
+        ASSERT_EQ(std::to_string(i * 2) + ":" + std::to_string(i),
+                  component->getChildAt(i)->getCalculated(kPropertyText).asString());
+
+    auto cache = component->getContext()->expressionCache();
+    ASSERT_TRUE(cache);
+    ASSERT_TRUE(cache->has("${data * 2}:${index}"));
+}
+
+/**
+ * A cached expression produces the same byte code as a fresh parse, including missing globals
+ */
+TEST_F(ExpressionCacheTest, MissingGlobal)
+{
+    loadDocument(SEQUENCE);
+    auto context = Context::createFromParent(component->getContext());
+    auto map = JsonData(R"({"b": 3})");
+    context->putUserWriteable("a", map.get());
+
+    for (int i = 0 ; i < 2 ; i++) {
+        auto result = parseAndEvaluate(*context, "${missing ?? a.b}", false);
+        ASSERT_TRUE(IsEqual(3, result.value));
+        ASSERT_TRUE(result.expression.is<datagrammar::ByteCode>());
+
+        auto byteCode = result.expression.get<datagrammar::ByteCode>();
+        ASSERT_EQ(2, byteCode->dataCount());
+        ASSERT_TRUE(IsEqual("b", byteCode->dataAt(1)));
+        ASSERT_EQ(1, result.symbols.size());
+    }
+
+    ASSERT_TRUE(component->getContext()->expressionCache()->has("${missing ?? a.b}"));
+}
+
+/**
+ * Relative dimensions are calculated for the context that uses them
+ */
+TEST_F(ExpressionCacheTest, Dimension)
+{
+    metrics.size(1000, 500);
+    loadDocument(SEQUENCE);
+
+    for (int i = 0 ; i < 2 ; i++) {
+        auto result = parseAndEvaluate(*component->getContext(), "${10vw + 10vh}");
+        ASSERT_TRUE(IsEqual(Dimension(150), result.value));
+    }
+}
+
+TEST_F(ExpressionCacheTest, SyntaxErrorsAreNotCached)
+{
+    loadDocument(SEQUENCE);
+    auto context = component->getContext();
+
+    for (int i = 0 ; i < 2 ; i++) {
+        auto result = parseAndEvaluate(*context, "${1+}");
+        ASSERT_TRUE(IsEqual("${1+}", result.value));
+        ASSERT_TRUE(ConsoleMessage());
+    }
+
+    ASSERT_FALSE(context->expressionCache()->has("${1+}"));
+}
+
+TEST_F(ExpressionCacheTest, Disabled)
+{
+    config->set(RootProperty::kExpressionCacheLimit, 0);
+    loadDocument(SEQUENCE);
+    ASSERT_EQ(5, component->getChildCount());
+    ASSERT_EQ("8:4", component->getChildAt(4)->getCalculated(kPropertyText).asString());
+    ASSERT_FALSE(component->getContext()->expressionCache());
+}
@@ -19,6 +19,7 @@
 #include "./dynamicindexlisttest.h"
 
 #include "apl/dynamicdata.h"
+#include "apl/livedata/columnarbatch.h"
 
 using namespace apl;
 
@@ -2688,3 +2689,203 @@ TEST_F(DynamicIndexListLazyTest, NewDataCanArriveDuringPageTransitions)
     // Some errors are expected from unfulfilled requests
     ASSERT_TRUE(ds->getPendingErrors().size() > 0);
 }
+
+static const char *BASIC_TITLES = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "parameters": [
+      "dynamicSource"
+    ],
+    "item": {
+      "type": "Sequence",
+      "id": "sequence",
+      "height": 300,
+      "data": "${dynamicSource}",
+      "items": {
+        "type": "Text",
+        "width": 100,
+        "height": 100,
+        "text": "${data.title ? data.title : data}"
+      }
+    }
+  }
+})";
+
+TEST_F(DynamicIndexListLazyTest, ColumnarBatchResponse)
+{
+    loadDocument(BASIC_TITLES, DATA);
+    advanceTime(10);
+    ASSERT_EQ(5, component->getChildCount());
+
+    ASSERT_TRUE(CheckFetchRequest("vQdpOESlok", "101", 15, 5));
+    ASSERT_TRUE(CheckFetchRequest("vQdpOESlok", "102", 5, 5));
+
+    ColumnarBatchBuilder builder({{"title", ColumnarBatch::kString}});
+    for (int i = 15 ; i < 20 ; i++)
+        builder.add({"Title ${" + std::to_string(i) + "}"});
+    auto batch = ColumnarBatch::create(builder.build());
+    ASSERT_TRUE(batch);
+
+    auto response = std::make_shared<ObjectMap>(ObjectMap{
+        {"listId", "vQdpOESlok"},
+        {"correlationToken", "101"},
+        {"startIndex", 15},
+        {"items", Object(std::make_shared<ObjectArray>(batch->rows()))}});
+    ASSERT_TRUE(ds->processUpdate(Object(response)));
+    root->clearPending();
+
+    ASSERT_EQ(10, component->getChildCount());
+    ASSERT_EQ("10", component->getChildAt(0)->getCalculated(kPropertyText).asString());
+
+    // Batch values are literal; they are not evaluated as data-binding expressions
+    ASSERT_EQ("Title ${19}", component->getChildAt(9)->getCalculated(kPropertyText).asString());
+}
+
+static const char *ADAPTIVE_DATA = R"({
+  "dynamicSource": {
+    "type": "adaptiveList",
+    "listId": "vQdpOESlok",
+    "startIndex": 0,
+    "minimumInclusiveIndex": 0,
+    "maximumExclusiveIndex": 1000,
+    "items": [ 0, 1, 2, 3, 4 ]
+  }
+})";
+
+TEST_F(DynamicIndexListLazyTest, AdaptivePrefetch)
+{
+    auto adaptive = std::make_shared<DynamicIndexListDataSourceProvider>(
+        DynamicIndexListConfiguration()
+            .setType("adaptiveList")
+            .setCacheChunkSize(TEST_CHUNK_SIZE)
+            .setMaxCacheChunkSize(40)
+            .setFetchTimeout(1000));
+    config->dataSourceProvider("adaptiveList", adaptive);
+    loadDocument(BASIC, ADAPTIVE_DATA);
+
+    // Scroll as fast as the loaded content allows and answer every fetch 50 milliseconds later
+    size_t fetches = 0;
+    int largest = 0;
+    for (int step = 0 ; step < 20 ; step++) {
+        component->update(kUpdateScrollPosition, component->getCalculated(kPropertyScrollPosition).asNumber() + 1000);
+        root->clearPending();
+        advanceTime(50);
+
+        while (root->hasEvent()) {
+            auto event = root->popEvent();
+            ASSERT_EQ(kEventTypeDataSourceFetchRequest, event.getType());
+            auto request = event.getValue(kEventPropertyValue);
+            auto start = request.get(START_INDEX).getInteger();
+            auto count = request.get(COUNT).getInteger();
+            largest = std::max(largest, count);
+            fetches++;
+
+            std::string items;
+            for (int i = start ; i < start + count ; i++)
+                items += (i == start ? "" : ",") + std::to_string(i);
+            ASSERT_TRUE(adaptive->processUpdate(
+                createLazyLoad(-1, std::stoi(request.get(CORRELATION_TOKEN).getString()), start, items)));
+        }
+        root->clearPending();
+    }
+
+    // The window grew beyond the chunk size once the scroll speed and latency were known
+    ASSERT_GT(largest, TEST_CHUNK_SIZE);
+    ASSERT_LE(largest, 40);
+
+    auto stats = adaptive->getFetchStats("vQdpOESlok");
+    ASSERT_EQ(fetches, stats.issued);
+    ASSERT_EQ(fetches, stats.completed);
+    ASSERT_GT(stats.latency, 0);
+    ASSERT_LE(stats.latency, 50);
+    ASSERT_GT(stats.velocity, 0);
+    ASSERT_TRUE(adaptive->getPendingErrors().empty());
+
+    // Without a maximum chunk size the window stays fixed
+    ASSERT_EQ(TEST_CHUNK_SIZE, ds->getConfiguration().cacheChunkSize);
+    ASSERT_EQ(0, ds->getConfiguration().maxCacheChunkSize);
+}
+
+static const char *EVICTING_DATA = R"({
+  "dynamicSource": {
+    "type": "evictingList",
+    "listId": "vQdpOESlok",
+    "startIndex": 0,
+    "minimumInclusiveIndex": 0,
+    "maximumExclusiveIndex": 1000,
+    "items": [ 0, 1, 2, 3, 4 ]
+  }
+})";
+
+TEST_F(DynamicIndexListLazyTest, Eviction)
+{
+    auto evicting = std::make_shared<DynamicIndexListDataSourceProvider>(
+        DynamicIndexListConfiguration()
+            .setType("evictingList")
+            .setCacheChunkSize(TEST_CHUNK_SIZE)
+            .setEvictionDistance(10)
+            .setFetchTimeout(1000));
+    config->dataSourceProvider("evictingList", evicting);
+    loadDocument(BASIC, EVICTING_DATA);
+
+    // The item shown at the top of the sequence
+    auto topItem = [&]() {
+        return component->getDisplayedChildAt(0)->getCalculated(kPropertyText).asString();
+    };
+
+    auto answerFetches = [&]() {
+        while (root->hasEvent()) {
+            auto event = root->popEvent();
+            ASSERT_EQ(kEventTypeDataSourceFetchRequest, event.getType());
+            auto request = event.getValue(kEventPropertyValue);
+            auto start = request.get(START_INDEX).getInteger();
+            auto count = request.get(COUNT).getInteger();
+            std::string items;
+            for (int i = start ; i < start + count ; i++)
+                items += (i == start ? "" : ",") + std::to_string(i);
+            ASSERT_TRUE(evicting->processUpdate(
+                createLazyLoad(-1, std::stoi(request.get(CORRELATION_TOKEN).getString()), start, items)));
+        }
+        root->clearPending();
+    };
+
+    // Scroll far down.  Dropping items never moves what is on screen.
+    size_t largest = 0;
+    for (int step = 0 ; step < 30 ; step++) {
+        component->update(kUpdateScrollPosition, component->getCalculated(kPropertyScrollPosition).asNumber() + 500);
+        root->clearPending();
+        auto top = topItem();
+        advanceTime(50);
+        answerFetches();
+        ASSERT_EQ(top, topItem()) << "step " << step;
+        largest = std::max(largest, component->getChildCount());
+    }
+
+    auto stats = evicting->getFetchStats("vQdpOESlok");
+    ASSERT_GT(stats.evicted, 0);
+    ASSERT_LT(largest, 60);
+    ASSERT_LT(100, std::stoi(topItem()));
+    ASSERT_NE("0", component->getChildAt(0)->getCalculated(kPropertyText).asString());
+
+    // The data source context reports the first item still loaded
+    rapidjson::Document doc;
+    auto context = root->serializeDataSourceContext(doc.GetAllocator());
+    ASSERT_EQ(std::stoi(component->getChildAt(0)->getCalculated(kPropertyText).asString()),
+              context[0]["startIndex"].GetInt());
+
+    // Scrolling back fetches the dropped items again
+    for (int step = 0 ; step < 60 && component->getCalculated(kPropertyScrollPosition).asNumber() > 0 ; step++) {
+        component->update(kUpdateScrollPosition, component->getCalculated(kPropertyScrollPosition).asNumber() - 500);
+        root->clearPending();
+        auto top = topItem();
+        advanceTime(50);
+        answerFetches();
+        ASSERT_EQ(top, topItem()) << "step " << step;
+    }
+
+    ASSERT_EQ(0, component->getCalculated(kPropertyScrollPosition).asNumber());
+    ASSERT_EQ("0", component->getChildAt(0)->getCalculated(kPropertyText).asString());
+    ASSERT_LT(component->getChildCount(), 60);
+    ASSERT_TRUE(evicting->getPendingErrors().empty());
+}
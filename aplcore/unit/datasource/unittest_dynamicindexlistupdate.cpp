@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <thread>
+
 #include "../testeventloop.h"
 
 #include "apl/component/pagercomponent.h"
@@ -1432,3 +1434,148 @@ TEST_F(DynamicIndexListUpdateTest, VisualHashRecalculatedOnDynamicDataUpdate) {
     // Check current visual hash for current top and second item are different
     ASSERT_NE(currentTopItemVisualHash, previousTopItemNewVisualHash);
 }
+
+/**
+ * Index list provider that counts the changes broadcast by the LiveArray of its lists.
+ */
+class CountingIndexListProvider : public DynamicIndexListDataSourceProvider {
+public:
+    explicit CountingIndexListProvider(const DynamicIndexListConfiguration& config)
+        : DynamicIndexListDataSourceProvider(config) {}
+
+    std::shared_ptr<DynamicListDataSourceConnection> createConnection(
+        const Object& sourceDefinition,
+        std::weak_ptr<Context> context,
+        std::weak_ptr<LiveArray> liveArray,
+        const std::string& listId) override {
+        auto array = liveArray.lock();
+        if (array)
+            array->addChangeCallback([this](const LiveArrayChange&) { changes++; });
+        return DynamicIndexListDataSourceProvider::createConnection(sourceDefinition, context, liveArray, listId);
+    }
+
+    int changes = 0;
+};
+
+static const char *COUNTING_DATA = R"({
+  "dynamicSource": {
+    "type": "countingList",
+    "listId": "vQdpOESlok",
+    "startIndex": 10,
+    "minimumInclusiveIndex": 10,
+    "maximumExclusiveIndex": 15,
+    "items": [ 10, 11, 12, 13, 14 ]
+  }
+})";
+
+static const char *ADJACENT_CRUD_SERIES = R"({
+  "presentationToken": "presentationToken",
+  "listId": "vQdpOESlok",
+  "listVersion": 1,
+  "operations": [
+    { "type": "InsertItem", "index": 11, "item": 111 },
+    { "type": "InsertItem", "index": 12, "item": 112 },
+    { "type": "InsertMultipleItems", "index": 13, "items": [ 113, 114 ] },
+    { "type": "SetItem", "index": 15, "item": 115 },
+    { "type": "SetItem", "index": 16, "item": 116 },
+    { "type": "DeleteItem", "index": 17 },
+    { "type": "DeleteMultipleItems", "index": 17, "count": 1 }
+  ]
+})";
+
+TEST_F(DynamicIndexListUpdateTest, CrudAdjacentOperationsBatched)
+{
+    auto counting = std::make_shared<CountingIndexListProvider>(
+        DynamicIndexListConfiguration().setType("countingList").setCacheChunkSize(5));
+    config->dataSourceProvider("countingList", counting);
+    loadDocument(BASIC, COUNTING_DATA);
+    ASSERT_TRUE(CheckChildren({10, 11, 12, 13, 14}));
+    counting->changes = 0;
+
+    ASSERT_TRUE(counting->processUpdate(ADJACENT_CRUD_SERIES));
+    root->clearPending();
+
+    // One change for the inserts, one for the replacements and one for the removals
+    ASSERT_EQ(3, counting->changes);
+    ASSERT_TRUE(CheckChildren({10, 111, 112, 113, 114, 115, 116}));
+    ASSERT_EQ(std::make_pair(10, 17), counting->getBounds("vQdpOESlok"));
+    ASSERT_TRUE(counting->getPendingErrors().empty());
+}
+
+static const char *PARTIAL_DELETE_SERIES = R"({
+  "presentationToken": "presentationToken",
+  "listId": "vQdpOESlok",
+  "listVersion": 1,
+  "operations": [
+    { "type": "DeleteItem", "index": 13 },
+    { "type": "DeleteItem", "index": 13 },
+    { "type": "DeleteItem", "index": 13 }
+  ]
+})";
+
+TEST_F(DynamicIndexListUpdateTest, CrudBatchedOperationsOutOfRange)
+{
+    auto counting = std::make_shared<CountingIndexListProvider>(
+        DynamicIndexListConfiguration().setType("countingList").setCacheChunkSize(5));
+    config->dataSourceProvider("countingList", counting);
+    loadDocument(BASIC, COUNTING_DATA);
+    counting->changes = 0;
+
+    // The run does not fit, so the operations are applied one by one up to the failing one
+    ASSERT_FALSE(counting->processUpdate(PARTIAL_DELETE_SERIES));
+    root->clearPending();
+
+    ASSERT_EQ(2, counting->changes);
+    ASSERT_TRUE(CheckChildren({10, 11, 12}));
+
+    auto errors = counting->getPendingErrors().getArray();
+    ASSERT_EQ(1, errors.size());
+    ASSERT_EQ("LIST_INDEX_OUT_OF_RANGE", errors.at(0).get("reason").asString());
+}
+
+TEST_F(DynamicIndexListUpdateTest, PreparedUpdateFromWorkerThread)
+{
+    loadDocument(BASIC, RESTRICTED_DATA);
+    ASSERT_TRUE(CheckChildren({10, 11, 12, 13, 14}));
+
+    // Parse and check the payload away from the engine thread
+    PreparedListUpdate prepared;
+    std::thread worker([&]() { prepared = ds->prepareUpdate(std::string(BASIC_CRUD_SERIES)); });
+    worker.join();
+
+    ASSERT_TRUE(prepared.valid());
+    ASSERT_EQ("vQdpOESlok", prepared.getListId());
+    ASSERT_TRUE(prepared.getError().empty());
+
+    ASSERT_TRUE(ds->processUpdate(prepared));
+    root->clearPending();
+
+    ASSERT_TRUE(CheckChildren({10, 111, 113, 13, 14}));
+}
+
+TEST_F(DynamicIndexListUpdateTest, PreparedUpdateInvalid)
+{
+    loadDocument(BASIC, RESTRICTED_DATA);
+
+    // Broken JSON is dropped without an error, as for an unprepared payload
+    auto prepared = ds->prepareUpdate(std::string("{ \"listId\": "));
+    ASSERT_FALSE(prepared.parsed());
+    ASSERT_FALSE(prepared.valid());
+    ASSERT_FALSE(ds->processUpdate(prepared));
+    ASSERT_TRUE(ds->getPendingErrors().empty());
+
+    prepared = ds->prepareUpdate(std::string(R"({ "listId": "vQdpOESlok", "listVersion": 1 })"));
+    ASSERT_TRUE(prepared.parsed());
+    ASSERT_FALSE(prepared.valid());
+    ASSERT_EQ("Payload missing required fields.", prepared.getError());
+
+    // A payload that fails the checks reports the same errors when applied
+    prepared = ds->prepareUpdate(std::string(WRONG_TYPE_CRUD));
+    ASSERT_TRUE(prepared.parsed());
+    ASSERT_FALSE(prepared.valid());
+    ASSERT_EQ("Wrong update type.", prepared.getError());
+
+    ASSERT_FALSE(ds->processUpdate(prepared));
+    ASSERT_TRUE(CheckErrors({ "INVALID_OPERATION" }));
+    ASSERT_TRUE(CheckChildren({10, 11, 12, 13, 14}));
+}
@@ -2253,3 +2253,94 @@ TEST_F(DynamicTokenListTest, DataCanChangeDuringPageTransition) {
     // We have only fulfilled on request, so there will be some errors
     ASSERT_TRUE(ds->getPendingErrors().size() > 0);
 }
+
+static const char *EVICTING_DATA = R"({
+  "dynamicSource": {
+    "type": "evictingTokenList",
+    "listId": "vQdpOESlok",
+    "pageToken": "f4",
+    "backwardPageToken": "b3",
+    "forwardPageToken": "f5",
+    "items": [ 20, 21, 22, 23, 24 ]
+  }
+})";
+
+TEST_F(DynamicTokenListTest, Eviction) {
+    auto evicting = std::make_shared<DynamicTokenListDataSourceProvider>(
+        DynamicListConfiguration("evictingTokenList")
+            .setCacheChunkSize(5)
+            .setEvictionDistance(10)
+            .setFetchTimeout(1000));
+    config->dataSourceProvider("evictingTokenList", evicting);
+    loadDocument(BASIC, EVICTING_DATA);
+
+    // Pages of five items.  "f<N>" continues forward and "b<N>" backward from page N.
+    const int PAGES = 40;
+    auto answerFetches = [&]() {
+        while (root->hasEvent()) {
+            auto event = root->popEvent();
+            ASSERT_EQ(kEventTypeDataSourceFetchRequest, event.getType());
+            auto request = event.getValue(kEventPropertyValue);
+            auto token = request.get(PAGE_TOKEN).getString();
+            auto page = std::stoi(token.substr(1));
+            auto forward = token[0] == 'f';
+            std::string next;
+            if (forward && page + 1 < PAGES)
+                next = "f" + std::to_string(page + 1);
+            else if (!forward && page > 0)
+                next = "b" + std::to_string(page - 1);
+
+            std::string items;
+            for (int i = 5 * page ; i < 5 * page + 5 ; i++)
+                items += (i == 5 * page ? "" : ",") + std::to_string(i);
+            ASSERT_TRUE(evicting->processUpdate(
+                createLazyLoad(std::stoi(request.get(CORRELATION_TOKEN).getString()), token, next, items)));
+        }
+        root->clearPending();
+    };
+
+    auto topItem = [&]() {
+        return component->getDisplayedChildAt(0)->getCalculated(kPropertyText).asString();
+    };
+
+    advanceTime(10);
+    answerFetches();
+
+    // Scroll to the end.  Pages far behind are dropped as whole pages.
+    size_t largest = 0;
+    for (int step = 0 ; step < 60 ; step++) {
+        component->update(kUpdateScrollPosition, component->getCalculated(kPropertyScrollPosition).asNumber() + 500);
+        root->clearPending();
+        auto top = topItem();
+        advanceTime(50);
+        answerFetches();
+        ASSERT_EQ(top, topItem()) << "step " << step;
+        largest = std::max(largest, component->getChildCount());
+    }
+
+    ASSERT_EQ("199", component->getChildAt(component->getChildCount() - 1)->getCalculated(kPropertyText).asString());
+    ASSERT_NE("0", component->getChildAt(0)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ(0, std::stoi(component->getChildAt(0)->getCalculated(kPropertyText).asString()) % 5);
+    ASSERT_GT(evicting->getFetchStats("vQdpOESlok").evicted, 0);
+    ASSERT_LT(largest, 60);
+
+    // Scroll back to the start.  Dropped pages are fetched with the tokens they were loaded with.
+    for (int step = 0 ; step < 100 && component->getCalculated(kPropertyScrollPosition).asNumber() > 0 ; step++) {
+        component->update(kUpdateScrollPosition, component->getCalculated(kPropertyScrollPosition).asNumber() - 500);
+        root->clearPending();
+        auto top = topItem();
+        advanceTime(50);
+        answerFetches();
+        ASSERT_EQ(top, topItem()) << "step " << step;
+    }
+
+    ASSERT_EQ(0, component->getCalculated(kPropertyScrollPosition).asNumber());
+    ASSERT_EQ("0", component->getChildAt(0)->getCalculated(kPropertyText).asString());
+    ASSERT_LT(component->getChildCount(), 60);
+
+    // Items are contiguous, so every page came back in the right place
+    for (int i = 0 ; i < component->getChildCount() ; i++)
+        ASSERT_EQ(std::to_string(i), component->getChildAt(i)->getCalculated(kPropertyText).asString());
+
+    ASSERT_TRUE(evicting->getPendingErrors().empty());
+}
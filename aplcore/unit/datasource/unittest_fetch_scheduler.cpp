@@ -0,0 +1,126 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "apl/datasource/fetchscheduler.h"
+
+using namespace apl;
+
+TEST(FetchSchedulerTest, WindowFollowsVelocityAndLatency)
+{
+    FetchScheduler scheduler(5, 40, 0);
+    ASSERT_EQ(5, scheduler.window(true));
+    ASSERT_EQ(5, scheduler.window(false));
+
+    // Learn a latency of 100 milliseconds
+    size_t index = 0, count = 5;
+    ASSERT_TRUE(scheduler.admit(index, count));
+    scheduler.issued("101", index, count, 0);
+    scheduler.completed("101", 100);
+    ASSERT_EQ(100, scheduler.stats().latency);
+
+    // Without movement the window stays at the minimum
+    ASSERT_EQ(5, scheduler.window(true));
+
+    // Several items ensured per frame, moving forward one item every 20 milliseconds
+    for (int frame = 0 ; frame < 10 ; frame++)
+        for (int i = 0 ; i < 3 ; i++)
+            scheduler.ensured(frame + i, 1000 + 20 * frame);
+
+    ASSERT_NEAR(0.05, scheduler.stats().velocity, 0.001);
+    ASSERT_EQ(5 + 5, scheduler.window(true));
+    ASSERT_EQ(5, scheduler.window(false));
+
+    // Faster scrolling is capped
+    for (int frame = 10 ; frame < 20 ; frame++)
+        scheduler.ensured(10 * frame, 1000 + 20 * frame);
+    ASSERT_EQ(40, scheduler.window(true));
+
+    // Reversing direction grows the other window
+    for (int frame = 20 ; frame < 30 ; frame++)
+        scheduler.ensured(380 - 10 * frame, 1000 + 20 * frame);
+    ASSERT_EQ(5, scheduler.window(true));
+    ASSERT_EQ(40, scheduler.window(false));
+}
+
+TEST(FetchSchedulerTest, Coalesce)
+{
+    FetchScheduler scheduler(5, 5, 0);
+
+    size_t index = 10, count = 10;
+    ASSERT_TRUE(scheduler.admit(index, count));
+    scheduler.issued("101", index, count, 0);
+
+    // Entirely in flight
+    index = 12; count = 5;
+    ASSERT_FALSE(scheduler.admit(index, count));
+
+    // The start is in flight
+    index = 15; count = 10;
+    ASSERT_TRUE(scheduler.admit(index, count));
+    ASSERT_EQ(20, index);
+    ASSERT_EQ(5, count);
+
+    // The end is in flight
+    index = 5; count = 10;
+    ASSERT_TRUE(scheduler.admit(index, count));
+    ASSERT_EQ(5, index);
+    ASSERT_EQ(5, count);
+
+    // Unrelated ranges are untouched
+    index = 30; count = 5;
+    ASSERT_TRUE(scheduler.admit(index, count));
+    ASSERT_EQ(30, index);
+    ASSERT_EQ(5, count);
+
+    // A retried request still covers its range until it completes
+    scheduler.retried("101", "102", 50);
+    index = 12; count = 5;
+    ASSERT_FALSE(scheduler.admit(index, count));
+
+    scheduler.completed("102", 80);
+    ASSERT_EQ(30, scheduler.stats().latency);
+    index = 12; count = 5;
+    ASSERT_TRUE(scheduler.admit(index, count));
+
+    auto stats = scheduler.stats();
+    ASSERT_EQ(7, stats.requested);
+    ASSERT_EQ(1, stats.issued);
+    ASSERT_EQ(4, stats.coalesced);
+    ASSERT_EQ(1, stats.completed);
+    ASSERT_EQ(0, stats.throttled);
+}
+
+TEST(FetchSchedulerTest, PendingLimit)
+{
+    FetchScheduler scheduler(5, 5, 2);
+
+    size_t index = 0, count = 5;
+    ASSERT_TRUE(scheduler.admit(index, count));
+    scheduler.issued("101", index, count, 0);
+
+    index = 5; count = 5;
+    ASSERT_TRUE(scheduler.admit(index, count));
+    scheduler.issued("102", index, count, 0);
+
+    index = 10; count = 5;
+    ASSERT_FALSE(scheduler.admit(index, count));
+    ASSERT_EQ(1, scheduler.stats().throttled);
+
+    scheduler.abandoned("101");
+    ASSERT_EQ(1, scheduler.pending());
+    ASSERT_TRUE(scheduler.admit(index, count));
+}
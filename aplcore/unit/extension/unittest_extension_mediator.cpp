@@ -1298,6 +1298,56 @@ TEST_F(ExtensionMediatorTest, ExtensionLifecycleWithExecutor) {
 }
 
 
+/**
+ * Executor that holds the tasks until they are drained, as a view host with its own message loop does.
+ */
+class QueuedExecutor : public alexaext::Executor {
+public:
+    bool enqueueTask(Task task) override {
+        tasks.emplace_back(std::move(task));
+        return true;
+    }
+
+    void drain() {
+        while (!tasks.empty()) {
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            task();
+        }
+    }
+
+    std::deque<Task> tasks;
+};
+
+TEST_F(ExtensionMediatorTest, LiveDataUpdateWithQueuedExecutor) {
+    // The messages are processed after the extension has released them
+    extensionProvider = std::make_shared<alexaext::ExtensionRegistrar>();
+    auto executor = std::make_shared<QueuedExecutor>();
+    mediator = ExtensionMediator::create(extensionProvider, executor);
+
+    loadExtensions(EXT_DOC);
+    ASSERT_FALSE(executor->tasks.empty());
+    executor->drain();
+
+    auto hello = testExtensions["aplext:hello:10"].lock();
+    inflate();
+    ASSERT_TRUE(hello->registered);
+
+    auto text = root->findComponentById("label");
+    ASSERT_TRUE(hello->generateLiveDataUpdate("aplext:hello:10", ENTITY_LIST_INSERT));
+    ASSERT_EQ(1, executor->tasks.size());
+    root->clearPending();
+    ASSERT_FALSE(root->hasEvent());
+
+    executor->drain();
+    ASSERT_FALSE(ConsoleMessage());
+    root->clearPending();
+    ASSERT_TRUE(root->hasEvent());
+    root->popEvent();
+    ASSERT_EQ("onEntityAdded:3", text->getCalculated(kPropertyText).asString());
+}
+
+
 static const char* BAD_EVENT = R"({
     "version": "1.0",
     "method": "Event",
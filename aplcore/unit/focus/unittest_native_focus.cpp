@@ -6811,4 +6811,91 @@ TEST_F(NativeFocusTest, PageredScrollView)
 
     ASSERT_EQ(scroller->getId(), fm.getFocus()->getId());
     ASSERT_TRUE(verifyFocusSwitchEvent(scroller, root->popEvent()));
-}
\ No newline at end of file
+}
+static const char *LARGE_GRID = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Container",
+      "width": 500,
+      "height": 500,
+      "direction": "row",
+      "wrap": "wrap",
+      "data": "${Array.range(100)}",
+      "items": {
+        "type": "TouchWrapper",
+        "id": "item${data}",
+        "width": 50,
+        "height": 50
+      }
+    }
+  }
+})";
+
+/**
+ * Repeated moves reuse the focusable components found by the first one
+ */
+TEST_F(NativeFocusTest, LargeGridKeyRepeat)
+{
+    loadDocument(LARGE_GRID);
+    auto& fm = root->context().focusManager();
+
+    executeCommand("SetFocus", {{"componentId", "item0"}}, false);
+    ASSERT_TRUE(verifyFocusSwitchEvent(root->findComponentById("item0"), root->popEvent()));
+
+    for (int i = 1 ; i < 10 ; i++) {
+        root->handleKeyboard(kKeyDown, Keyboard::ARROW_RIGHT_KEY());
+        auto child = root->findComponentById("item" + std::to_string(i));
+        ASSERT_EQ(child, fm.getFocus());
+        ASSERT_TRUE(verifyFocusSwitchEvent(child, root->popEvent()));
+    }
+
+    for (int i = 1 ; i < 10 ; i++) {
+        root->handleKeyboard(kKeyDown, Keyboard::ARROW_DOWN_KEY());
+        auto child = root->findComponentById("item" + std::to_string(i * 10 + 9));
+        ASSERT_EQ(child, fm.getFocus());
+        ASSERT_TRUE(verifyFocusSwitchEvent(child, root->popEvent()));
+    }
+
+    root->handleKeyboard(kKeyDown, Keyboard::ARROW_LEFT_KEY());
+    ASSERT_EQ(root->findComponentById("item98"), fm.getFocus());
+    ASSERT_TRUE(verifyFocusSwitchEvent(root->findComponentById("item98"), root->popEvent()));
+
+    root->handleKeyboard(kKeyDown, Keyboard::ARROW_UP_KEY());
+    ASSERT_EQ(root->findComponentById("item88"), fm.getFocus());
+    ASSERT_TRUE(verifyFocusSwitchEvent(root->findComponentById("item88"), root->popEvent()));
+}
+
+/**
+ * Changes to the layout and visibility of the components are picked up by the next move
+ */
+TEST_F(NativeFocusTest, LargeGridChanges)
+{
+    loadDocument(LARGE_GRID);
+    auto& fm = root->context().focusManager();
+
+    executeCommand("SetFocus", {{"componentId", "item44"}}, false);
+    ASSERT_TRUE(verifyFocusSwitchEvent(root->findComponentById("item44"), root->popEvent()));
+
+    // Hidden components are skipped
+    executeCommand("SetValue", {{"componentId", "item45"}, {"property", "display"}, {"value", "none"}}, false);
+    root->clearPending();
+    root->handleKeyboard(kKeyDown, Keyboard::ARROW_RIGHT_KEY());
+    ASSERT_EQ(root->findComponentById("item46"), fm.getFocus());
+    ASSERT_TRUE(verifyFocusSwitchEvent(root->findComponentById("item46"), root->popEvent()));
+
+    // Shown again: the next move finds it
+    executeCommand("SetValue", {{"componentId", "item45"}, {"property", "display"}, {"value", "normal"}}, false);
+    root->clearPending();
+    root->handleKeyboard(kKeyDown, Keyboard::ARROW_LEFT_KEY());
+    ASSERT_EQ(root->findComponentById("item45"), fm.getFocus());
+    ASSERT_TRUE(verifyFocusSwitchEvent(root->findComponentById("item45"), root->popEvent()));
+
+    // Taking a component out of the layout moves the ones after it
+    executeCommand("SetValue", {{"componentId", "item0"}, {"property", "display"}, {"value", "none"}}, false);
+    root->clearPending();
+    root->handleKeyboard(kKeyDown, Keyboard::ARROW_LEFT_KEY());
+    ASSERT_EQ(root->findComponentById("item44"), fm.getFocus());
+    ASSERT_TRUE(verifyFocusSwitchEvent(root->findComponentById("item44"), root->popEvent()));
+}
@@ -305,4 +305,91 @@ TEST_F(GraphicBindTest, MissingValue)
     auto text = container->getChildAt(0);
     ASSERT_TRUE(IsEqual("", text->getValue(apl::kGraphicPropertyText)));
     ASSERT_TRUE(ConsoleMessage());
-}
\ No newline at end of file
+}
+
+static const char *LEGACY_SHARED_CONTEXT = R"apl(
+{
+  "type": "APL",
+  "version": "1.5",
+  "graphics": {
+    "Legacy": {
+      "type": "AVG",
+      "version": "1.1",
+      "width": 100,
+      "height": 100,
+      "parameters": [ "Tint" ],
+      "items": {
+        "type": "group",
+        "items": [
+          {
+            "type": "path",
+            "pathData": "M0,0 L50,0 50,50 z",
+            "fill": "${Tint}"
+          },
+          {
+            "type": "path",
+            "bind": { "name": "Inner", "value": "${Tint}" },
+            "pathData": "M50,50 L100,50 100,100 z",
+            "stroke": "${Inner}"
+          }
+        ]
+      }
+    }
+  },
+  "mainTemplate": {
+    "items": {
+      "type": "VectorGraphic",
+      "id": "Legacy",
+      "source": "Legacy",
+      "width": 100,
+      "height": 100,
+      "scale": "fill",
+      "Tint": "blue"
+    }
+  }
+}
+)apl";
+
+// Static children of older graphics share their parent context; bound children get their own.
+// Dirty elements are registered once per frame and each of them is cleared by the graphic.
+TEST_F(GraphicBindTest, LegacySharedContext)
+{
+    loadDocument(LEGACY_SHARED_CONTEXT);
+    ASSERT_TRUE(component);
+
+    auto graphic = component->getCalculated(kPropertyGraphic).get<Graphic>();
+    auto container = graphic->getRoot();
+    auto group = container->getChildAt(0);
+    ASSERT_EQ(2, group->getChildCount());
+    auto fixed = group->getChildAt(0);
+    auto bound = group->getChildAt(1);
+    ASSERT_TRUE(IsEqual(Color(Color::BLUE), fixed->getValue(kGraphicPropertyFill)));
+    ASSERT_TRUE(IsEqual(Color(Color::BLUE), bound->getValue(kGraphicPropertyStroke)));
+
+    // The binding lives in the child context and does not leak into the shared parent context
+    ASSERT_TRUE(evaluate(*graphic->getContext(), "${Inner}").isNull());
+
+    executeCommand("SetValue", {{"componentId", "Legacy"}, {"property", "Tint"}, {"value", "red"}}, true);
+    executeCommand("SetValue", {{"componentId", "Legacy"}, {"property", "width"}, {"value", 200}}, true);
+    root->clearPending();
+
+    ASSERT_TRUE(IsEqual(Color(Color::RED), fixed->getValue(kGraphicPropertyFill)));
+    ASSERT_TRUE(IsEqual(Color(Color::RED), bound->getValue(kGraphicPropertyStroke)));
+    ASSERT_EQ(1, graphic->getDirty().count(container));
+    ASSERT_EQ(1, graphic->getDirty().count(fixed));
+    ASSERT_EQ(1, graphic->getDirty().count(bound));
+    ASSERT_EQ(0, graphic->getDirty().count(group));
+
+    root->clearDirty();
+    ASSERT_TRUE(graphic->getDirty().empty());
+    ASSERT_TRUE(container->getDirtyProperties().empty());
+    ASSERT_TRUE(fixed->getDirtyProperties().empty());
+    ASSERT_TRUE(bound->getDirtyProperties().empty());
+
+    // Elements re-register with the graphic after being cleared
+    executeCommand("SetValue", {{"componentId", "Legacy"}, {"property", "Tint"}, {"value", "green"}}, true);
+    ASSERT_TRUE(CheckDirty(fixed, kGraphicPropertyFill));
+    ASSERT_TRUE(CheckDirty(bound, kGraphicPropertyStroke));
+    ASSERT_TRUE(CheckDirty(graphic, fixed, bound));
+    ASSERT_TRUE(CheckDirty(component, kPropertyGraphic, kPropertyVisualHash));
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <random>
+
+#include "../testeventloop.h"
+#include "apl/livedata/chunkedobjectarray.h"
+
+using namespace apl;
+
+class ChunkedObjectArrayTest : public ::testing::Test {};
+
+static ::testing::AssertionResult
+Matches(const ObjectArray& expected, const ChunkedObjectArray& actual)
+{
+    if (expected.size() != actual.size())
+        return ::testing::AssertionFailure() << "size mismatch expected=" << expected.size()
+                                             << " actual=" << actual.size();
+
+    for (size_t i = 0 ; i < expected.size() ; i++) {
+        if (expected.at(i) != actual.at(i))
+            return ::testing::AssertionFailure() << "mismatch at " << i << " expected=" << expected.at(i).toDebugString()
+                                                 << " actual=" << actual.at(i).toDebugString();
+    }
+
+    size_t index = 0;
+    bool ordered = true;
+    actual.forEach([&](const Object& item) { ordered = ordered && item == expected.at(index++); });
+    if (!ordered || index != expected.size())
+        return ::testing::AssertionFailure() << "forEach mismatch";
+
+    if (actual.getArray() != expected)
+        return ::testing::AssertionFailure() << "getArray mismatch";
+
+    return ::testing::AssertionSuccess();
+}
+
+TEST_F(ChunkedObjectArrayTest, Basic)
+{
+    ChunkedObjectArray array;
+    ASSERT_TRUE(array.empty());
+    ASSERT_TRUE(array.getArray().empty());
+
+    array.insert(0, Object("b"));
+    array.insert(0, Object("a"));
+    array.insert(2, ObjectArray{"c", "d"});
+    ASSERT_TRUE(Matches({"a", "b", "c", "d"}, array));
+
+    array.set(1, Object("B"));
+    array.erase(2, 1);
+    ASSERT_TRUE(Matches({"a", "B", "d"}, array));
+
+    array.clear();
+    ASSERT_TRUE(array.empty());
+}
+
+TEST_F(ChunkedObjectArrayTest, LargeArray)
+{
+    const size_t count = ChunkedObjectArray::BLOCK_SIZE * 10 + 7;
+    ObjectArray expected;
+    for (size_t i = 0 ; i < count ; i++)
+        expected.emplace_back(static_cast<int>(i));
+
+    ChunkedObjectArray array{ObjectArray(expected)};
+    ASSERT_TRUE(Matches(expected, array));
+
+    // The cached view is patched in place by set()
+    const auto& view = array.getArray();
+    array.set(1000, Object(-1));
+    expected[1000] = -1;
+    ASSERT_EQ(Object(-1), view.at(1000));
+
+    // Remove a range that spans several blocks
+    array.erase(100, ChunkedObjectArray::BLOCK_SIZE * 3);
+    expected.erase(expected.begin() + 100, expected.begin() + 100 + ChunkedObjectArray::BLOCK_SIZE * 3);
+    ASSERT_TRUE(Matches(expected, array));
+}
+
+TEST_F(ChunkedObjectArrayTest, RandomEdits)
+{
+    std::mt19937 random(7);
+    ObjectArray expected;
+    ChunkedObjectArray array;
+
+    for (int i = 0 ; i < 5000 ; i++) {
+        auto op = random() % 5;
+        if (expected.empty() || op < 2) {
+            // Bias towards the front, which is the common case for feeds
+            auto position = random() % 4 == 0 ? 0 : random() % (expected.size() + 1);
+            if (random() % 2) {
+                array.insert(position, Object(i));
+                expected.insert(expected.begin() + position, i);
+            }
+            else {
+                ObjectArray values(1 + random() % 600, Object(i));
+                expected.insert(expected.begin() + position, values.begin(), values.end());
+                array.insert(position, std::move(values));
+            }
+        }
+        else if (op == 2) {
+            auto position = random() % expected.size();
+            auto count = 1 + random() % std::min<size_t>(400, expected.size() - position);
+            array.erase(position, count);
+            expected.erase(expected.begin() + position, expected.begin() + position + count);
+        }
+        else {
+            auto position = random() % expected.size();
+            array.set(position, Object(-i));
+            expected[position] = -i;
+        }
+
+        if (i % 50 == 0)
+            ASSERT_TRUE(Matches(expected, array)) << "step " << i;
+    }
+
+    ASSERT_TRUE(Matches(expected, array));
+}
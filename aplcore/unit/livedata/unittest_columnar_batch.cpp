@@ -0,0 +1,124 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "../testeventloop.h"
+#include "apl/livedata/columnarbatch.h"
+
+using namespace apl;
+
+class ColumnarBatchTest : public DocumentWrapper {
+public:
+    static std::vector<std::uint8_t> sample() {
+        ColumnarBatchBuilder builder({{"id", ColumnarBatch::kNumber},
+                                      {"title", ColumnarBatch::kString},
+                                      {"featured", ColumnarBatch::kBoolean}});
+        builder.add({1, "Apple", true});
+        builder.add({2.5, "Banana", false});
+        builder.add({3, "", true});
+        return builder.build();
+    }
+};
+
+TEST_F(ColumnarBatchTest, Basic)
+{
+    auto batch = ColumnarBatch::create(sample());
+    ASSERT_TRUE(batch);
+    ASSERT_EQ(3, batch->rowCount());
+    ASSERT_EQ(3, batch->fieldCount());
+    ASSERT_EQ("title", batch->fieldName(1));
+    ASSERT_EQ(ColumnarBatch::kBoolean, batch->fieldType(2));
+    ASSERT_EQ(-1, batch->fieldIndex("missing"));
+
+    ASSERT_TRUE(IsEqual(2.5, batch->value(1, 0)));
+    ASSERT_TRUE(IsEqual("Banana", batch->value(1, 1)));
+    ASSERT_TRUE(IsEqual(false, batch->value(1, 2)));
+    ASSERT_TRUE(IsEqual("", batch->value(2, 1)));
+
+    auto row = batch->row(0);
+    ASSERT_TRUE(row.isMap());
+    ASSERT_EQ(3, row.size());
+    ASSERT_TRUE(row.has("title"));
+    ASSERT_FALSE(row.has("price"));
+    ASSERT_TRUE(IsEqual("Apple", row.get("title")));
+    ASSERT_TRUE(IsEqual(Object::NULL_OBJECT(), row.get("price")));
+    ASSERT_TRUE(IsEqual(7, row.opt("price", 7)));
+
+    // A row is equal to the equivalent ordinary map
+    auto map = std::make_shared<ObjectMap>(ObjectMap{{"id", 1}, {"title", "Apple"}, {"featured", true}});
+    ASSERT_EQ(Object(map), row);
+    ASSERT_EQ(3, row.getMap().size());
+
+    ASSERT_EQ(3, batch->rows().size());
+    ASSERT_TRUE(IsEqual(3, batch->rows().at(2).get("id")));
+}
+
+TEST_F(ColumnarBatchTest, Malformed)
+{
+    auto good = sample();
+
+    // Every truncation is rejected
+    for (size_t length = 0 ; length < good.size() ; length++)
+        ASSERT_FALSE(ColumnarBatch::create(std::vector<std::uint8_t>(good.begin(), good.begin() + length)))
+            << "length=" << length;
+
+    auto badMagic = good;
+    badMagic[0] = 'X';
+    ASSERT_FALSE(ColumnarBatch::create(std::move(badMagic)));
+
+    // A string that points past the end of the string table.  The string column follows the
+    // header and the number column.
+    auto header = 10 + (3 + 2) + (3 + 5) + (3 + 8);
+    auto badString = good;
+    badString[header + 3 * 8 + 4] = 200;
+    ASSERT_FALSE(ColumnarBatch::create(std::move(badString)));
+
+    auto badType = good;
+    badType[10] = 9;
+    ASSERT_FALSE(ColumnarBatch::create(std::move(badType)));
+}
+
+static const char *LIST_DOC = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Sequence",
+      "data": "${TestArray}",
+      "items": {
+        "type": "Text",
+        "text": "${data.id}:${data.title}${data.featured ? '*' : ''}"
+      }
+    }
+  }
+})";
+
+TEST_F(ColumnarBatchTest, BulkLoadLiveArray)
+{
+    auto myArray = LiveArray::create();
+    config->liveData("TestArray", myArray);
+    loadDocument(LIST_DOC);
+    ASSERT_EQ(0, component->getChildCount());
+
+    auto batch = ColumnarBatch::create(sample());
+    ASSERT_TRUE(myArray->push_back(batch->rows().begin(), batch->rows().end()));
+    root->clearPending();
+
+    ASSERT_EQ(3, component->getChildCount());
+    ASSERT_EQ("1:Apple*", component->getChildAt(0)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("2.5:Banana", component->getChildAt(1)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("3:*", component->getChildAt(2)->getCalculated(kPropertyText).asString());
+}
@@ -0,0 +1,191 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "../testeventloop.h"
+
+using namespace apl;
+
+class LiveProducerTest : public DocumentWrapper {};
+
+static const char *LIST_DOC = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Sequence",
+      "data": "${TestArray}",
+      "items": {
+        "type": "Text",
+        "text": "${data}"
+      }
+    }
+  }
+})";
+
+TEST_F(LiveProducerTest, ArrayMutationsWaitForFlush)
+{
+    auto myArray = LiveArray::create(ObjectArray{"A", "B"});
+    config->liveData("TestArray", myArray);
+
+    loadDocument(LIST_DOC);
+    ASSERT_EQ(2, component->getChildCount());
+
+    auto producer = myArray->producer();
+    producer.push_back("C");
+    producer.insert(0, "Z");
+    producer.update(1, "A2");
+    producer.remove(2);
+
+    // Nothing changes until the engine flushes
+    ASSERT_EQ(2, myArray->size());
+    root->clearPending();
+
+    ASSERT_EQ(3, myArray->size());
+    ASSERT_EQ(3, component->getChildCount());
+    ASSERT_EQ("Z", component->getChildAt(0)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("A2", component->getChildAt(1)->getCalculated(kPropertyText).asString());
+    ASSERT_EQ("C", component->getChildAt(2)->getCalculated(kPropertyText).asString());
+
+    auto stats = myArray->producerStats();
+    ASSERT_EQ(4, stats.enqueued);
+    ASSERT_EQ(4, stats.applied);
+    ASSERT_EQ(0, stats.coalesced);
+    ASSERT_EQ(1, stats.drains);
+}
+
+TEST_F(LiveProducerTest, ArrayCoalescing)
+{
+    auto myArray = LiveArray::create(ObjectArray{"A", "B"});
+    int broadcasts = 0;
+    myArray->addChangeCallback([&](const LiveArrayChange&) { broadcasts++; });
+
+    auto producer = myArray->producer();
+    producer.remove(5);     // Rejected
+    producer.clear();       // Supersedes the remove
+    for (int i = 0 ; i < 10 ; i++)
+        producer.push_back(i);
+    producer.update(3, "X");
+    producer.update(3, "Y");
+    producer.insert(1, "P");
+    producer.insert(2, "Q");
+
+    ASSERT_TRUE(myArray->applyPendingMutations());
+    ASSERT_FALSE(myArray->applyPendingMutations());
+
+    ASSERT_EQ(12, myArray->size());
+    ASSERT_EQ(Object(0), myArray->at(0));
+    ASSERT_EQ(Object("P"), myArray->at(1));
+    ASSERT_EQ(Object("Q"), myArray->at(2));
+    ASSERT_EQ(Object(1), myArray->at(3));
+    ASSERT_EQ(Object("Y"), myArray->at(5));
+
+    // clear, one push_back range, one update, one insert range
+    ASSERT_EQ(4, broadcasts);
+
+    auto stats = myArray->producerStats();
+    ASSERT_EQ(16, stats.enqueued);
+    ASSERT_EQ(4, stats.applied);
+    ASSERT_EQ(12, stats.coalesced);
+    ASSERT_EQ(0, stats.rejected);
+}
+
+static const char *MAP_DOC = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Text",
+      "text": "${TestMap.name} ${TestMap.count}"
+    }
+  }
+})";
+
+TEST_F(LiveProducerTest, MapCoalescing)
+{
+    auto myMap = LiveMap::create(ObjectMap{{"name", "Fred"}, {"count", 0}});
+    config->liveData("TestMap", myMap);
+
+    loadDocument(MAP_DOC);
+    ASSERT_EQ("Fred 0", component->getCalculated(kPropertyText).asString());
+
+    int broadcasts = 0;
+    myMap->addChangeCallback([&](const LiveMapChange&) { broadcasts++; });
+
+    auto producer = myMap->producer();
+    for (int i = 1 ; i <= 50 ; i++)
+        producer.set("count", i);
+    producer.set("name", "Barney");
+    producer.remove("missing");
+
+    root->clearPending();
+    ASSERT_EQ("Barney 50", component->getCalculated(kPropertyText).asString());
+    ASSERT_EQ(2, broadcasts);
+
+    auto stats = myMap->producerStats();
+    ASSERT_EQ(52, stats.enqueued);
+    ASSERT_EQ(2, stats.applied);
+    ASSERT_EQ(49, stats.coalesced);
+    ASSERT_EQ(1, stats.rejected);
+
+    producer.set("count", 7);
+    producer.replace(ObjectMap{{"name", "Wilma"}, {"count", 1}});
+    root->clearPending();
+    ASSERT_EQ("Wilma 1", component->getCalculated(kPropertyText).asString());
+}
+
+TEST_F(LiveProducerTest, ManyThreads)
+{
+    auto myArray = LiveArray::create();
+    config->liveData("TestArray", myArray);
+    loadDocument(LIST_DOC);
+
+    const int THREADS = 4;
+    const int ITEMS = 500;
+    std::vector<std::thread> threads;
+    for (int t = 0 ; t < THREADS ; t++) {
+        auto producer = myArray->producer();
+        threads.emplace_back([producer, t, ITEMS]() mutable {
+            for (int i = 0 ; i < ITEMS ; i++)
+                producer.push_back(t * ITEMS + i);
+        });
+    }
+
+    // Flush while the producers are still running
+    root->clearPending();
+
+    for (auto& thread : threads)
+        thread.join();
+    root->clearPending();
+
+    ASSERT_EQ(THREADS * ITEMS, myArray->size());
+    ASSERT_EQ(THREADS * ITEMS, component->getChildCount());
+
+    // Each producer's items arrive in the order that producer pushed them
+    std::vector<int> last(THREADS, -1);
+    myArray->forEach([&](const Object& item) {
+        auto value = item.asInt();
+        auto& previous = last[value / ITEMS];
+        ASSERT_LT(previous, value);
+        previous = value;
+    });
+
+    auto stats = myArray->producerStats();
+    ASSERT_EQ(THREADS * ITEMS, stats.enqueued);
+    ASSERT_EQ(stats.enqueued, stats.applied + stats.coalesced + stats.rejected);
+}
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <random>
+
 #include "gtest/gtest.h"
 
 #include "../testeventloop.h"
@@ -470,3 +472,166 @@ TEST_F(LiveArrayChangeTest, NestedChangeAreNotLaidOutTwice)
     ASSERT_EQ(2, innerA->getCalculated(kPropertyNotifyChildrenChanged).size());
     ASSERT_EQ(2, innerB->getCalculated(kPropertyNotifyChildrenChanged).size());
 }
+
+/**
+ * Reference implementation: walk the change log backwards for a single index
+ */
+static std::pair<int, bool>
+referenceNewToOld(const std::vector<LiveArrayChange>& changes, size_t index)
+{
+    bool changed = false;
+    for (auto it = changes.rbegin() ; it != changes.rend() ; it++) {
+        auto position = it->position();
+        auto count = it->count();
+        switch (it->command()) {
+            case LiveArrayChange::REMOVE:
+                if (index >= position)
+                    index += count;
+                break;
+            case LiveArrayChange::UPDATE:
+                if (index >= position && index < position + count)
+                    changed = true;
+                break;
+            case LiveArrayChange::INSERT:
+                if (index >= position + count)
+                    index -= count;
+                else if (index >= position)
+                    return {-1, false};
+                break;
+            default:
+                break;
+        }
+    }
+    return {static_cast<int>(index), changed};
+}
+
+TEST_F(LiveArrayChangeTest, IndexMapMatchesChangeLog)
+{
+    std::mt19937 random(42);
+
+    for (int trial = 0 ; trial < 200 ; trial++) {
+        size_t size = random() % 20;
+        std::vector<LiveArrayChange> changes;
+        auto changeCount = random() % 12;
+        for (size_t i = 0 ; i < changeCount ; i++) {
+            auto op = size == 0 ? 0 : random() % 3;
+            if (op == 0) {
+                auto count = 1 + random() % 3;
+                changes.emplace_back(LiveArrayChange::insert(random() % (size + 1), count));
+                size += count;
+            }
+            else {
+                auto position = random() % size;
+                auto count = 1 + random() % std::min<size_t>(3, size - position);
+                if (op == 1) {
+                    changes.emplace_back(LiveArrayChange::update(position, count));
+                }
+                else {
+                    changes.emplace_back(LiveArrayChange::remove(position, count));
+                    size -= count;
+                }
+            }
+        }
+
+        LiveArrayIndexMap map(changes, size);
+
+        // Walking the runs visits every new index exactly once
+        size_t index = 0;
+        for (const auto& run : map.runs()) {
+            ASSERT_GT(run.count, 0);
+            for (size_t i = 0 ; i < run.count ; i++, index++) {
+                auto expected = referenceNewToOld(changes, index);
+                auto actual = std::make_pair(run.oldIndex < 0 ? -1 : run.oldIndex + static_cast<int>(i),
+                                             run.oldIndex < 0 ? false : run.changed);
+                ASSERT_EQ(expected, actual) << "trial=" << trial << " index=" << index;
+                ASSERT_EQ(expected, map.newToOld(index)) << "trial=" << trial << " index=" << index;
+            }
+        }
+        ASSERT_EQ(size, index) << "trial=" << trial;
+    }
+}
+
+TEST_F(LiveArrayChangeTest, CoalescedChangesMatchChangeLog)
+{
+    config->liveData("TestArray", LiveArray::create(ObjectArray{"a", "b"}));
+    loadDocument(ARRAY_TEST);
+
+    std::mt19937 random(7);
+
+    for (int trial = 0 ; trial < 50 ; trial++) {
+        ObjectArray items;
+        auto initial = 1 + random() % 15;
+        for (size_t i = 0 ; i < initial ; i++)
+            items.emplace_back("item " + std::to_string(i));
+        auto myArray = LiveArray::create(std::move(items));
+        auto tracker = LiveDataObject::create(myArray, context, "Trial" + std::to_string(trial))->asArray();
+        ASSERT_TRUE(tracker);
+
+        // Keep the operations in one neighbourhood so that many of them coalesce
+        std::vector<LiveArrayChange> changes;
+        size_t size = initial;
+        size_t cursor = random() % size;
+        for (int i = 0 ; i < 20 ; i++) {
+            auto op = size == 0 ? 0 : random() % 3;
+            auto position = std::min<size_t>(cursor, op == 0 ? size : size - 1);
+            auto value = "v" + std::to_string(trial) + "." + std::to_string(i);
+            if (op == 0) {
+                ASSERT_TRUE(myArray->insert(position, value));
+                changes.emplace_back(LiveArrayChange::insert(position, 1));
+                size++;
+            }
+            else if (op == 1) {
+                ASSERT_TRUE(myArray->update(position, value));
+                changes.emplace_back(LiveArrayChange::update(position, 1));
+            }
+            else {
+                ASSERT_TRUE(myArray->remove(position));
+                changes.emplace_back(LiveArrayChange::remove(position, 1));
+                size--;
+            }
+
+            if (random() % 2 == 0 && cursor > 0)
+                cursor--;
+            else if (cursor < size)
+                cursor++;
+        }
+
+        if (size == 0)  // Emptying the array turns it into a replacement
+            continue;
+
+        ASSERT_LE(tracker->getChanges().size(), changes.size());
+
+        for (size_t index = 0 ; index < size ; index++)
+            ASSERT_EQ(referenceNewToOld(changes, index), tracker->newToOld(index))
+                << "trial=" << trial << " index=" << index;
+    }
+}
+
+TEST_F(LiveArrayChangeTest, CoalesceSimpleSequences)
+{
+    auto myArray = LiveArray::create(ObjectArray{"a", "b", "c"});
+    config->liveData("TestArray", myArray);
+    loadDocument(ARRAY_TEST);
+
+    auto tracker = context->opt("TestArray").getLiveDataObject()->asArray();
+    ASSERT_TRUE(tracker);
+
+    // Repeated updates of one item
+    for (int i = 0 ; i < 10 ; i++)
+        myArray->update(1, i);
+    ASSERT_EQ(1, tracker->getChanges().size());
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("9", component->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(CheckDirty(component, kPropertyText, kPropertyVisualHash));
+
+    // An insert followed by removing the inserted item leaves nothing to do
+    myArray->insert(1, "x");
+    myArray->remove(1);
+    ASSERT_EQ(0, tracker->getChanges().size());
+
+    // Storing the same value is not a change
+    myArray->update(1, 9);
+    ASSERT_EQ(0, tracker->getChanges().size());
+    root->clearPending();
+    ASSERT_TRUE(CheckDirty(component));
+}
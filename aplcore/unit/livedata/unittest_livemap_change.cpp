@@ -280,4 +280,51 @@ TEST_F(LiveMapChangeTest, PopulateLayoutMap)
     root->clearPending();
 
     ASSERT_TRUE(IsEqual("think so", component->getCalculated(kPropertyText).asString()));
-}
\ No newline at end of file
+}
+// Repeated changes to a key collapse into one change, and undone changes disappear
+TEST_F(LiveMapChangeTest, Coalesced)
+{
+    auto myMap = LiveMap::create(ObjectMap{{"adjective", "happy"},
+                                           {"noun",      "dog"}});
+    config->liveData("TestMap", myMap);
+
+    loadDocument(MAP_TEST);
+    ASSERT_TRUE(component);
+
+    auto tracker = context->opt("TestMap").getLiveDataObject()->asMap();
+    ASSERT_TRUE(tracker);
+
+    for (int i = 0 ; i < 50 ; i++)
+        myMap->set("noun", "dog" + std::to_string(i));
+    ASSERT_EQ(1, tracker->getChanges().size());
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("happy dog49", component->getCalculated(kPropertyText).asString()));
+    ASSERT_TRUE(CheckDirty(component, kPropertyText, kPropertyVisualHash));
+    root->clearDirty();
+
+    // Changing a value and changing it back does not recalculate anything
+    myMap->set("noun", "cat");
+    myMap->set("noun", "dog49");
+    ASSERT_TRUE(LiveMapTrack("TestMap", context,
+                             {{"adjective", "happy", false},
+                              {"noun",      "dog49", false}}));
+    root->clearPending();
+    ASSERT_TRUE(CheckDirty(root));
+
+    // Adding and removing a key, or setting the same value, is also not a change
+    myMap->set("verb", "run");
+    ASSERT_TRUE(myMap->remove("verb"));
+    myMap->set("adjective", "happy");
+    ASSERT_EQ(0, tracker->getChanges().size());
+    root->clearPending();
+    ASSERT_TRUE(CheckDirty(root));
+
+    // A removed key that comes back with a new value is a change
+    ASSERT_TRUE(myMap->remove("adjective"));
+    myMap->set("adjective", "sad");
+    ASSERT_TRUE(LiveMapTrack("TestMap", context,
+                             {{"adjective", "sad",   true},
+                              {"noun",      "dog49", false}}));
+    root->clearPending();
+    ASSERT_TRUE(IsEqual("sad dog49", component->getCalculated(kPropertyText).asString()));
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ *
+ */
+
+#include "../testeventloop.h"
+#include "apl/scenegraph/builder.h"
+#include "apl/scenegraph/tessellation.h"
+
+using namespace apl;
+
+class SGTessellationTest : public ::testing::Test {};
+
+/**
+ * Signed area of a closed contour.  Screen coordinates have y pointing down, so counter-clockwise
+ * contours on the screen have a negative area.
+ */
+static float
+signedArea(const sg::Contour& contour)
+{
+    const auto& p = contour.points;
+    float area = 0;
+    for (size_t i = 0, j = p.size() - 1 ; i < p.size() ; j = i++)
+        area += p[j].getX() * p[i].getY() - p[i].getX() * p[j].getY();
+    return area / 2;
+}
+
+static std::shared_ptr<sg::StrokePathOp>
+asStroke(const sg::PathOpPtr& op)
+{
+    return std::static_pointer_cast<sg::StrokePathOp>(op);
+}
+
+static float
+totalArea(const sg::Contours& contours)
+{
+    float area = 0;
+    for (const auto& contour : contours)
+        area += signedArea(contour);
+    return area;
+}
+
+TEST_F(SGTessellationTest, Rect)
+{
+    auto contours = sg::flattenPath(*sg::path(Rect{10, 20, 30, 40}), Transform2D(), 0.25f);
+    ASSERT_EQ(1, contours.size());
+    ASSERT_TRUE(contours[0].closed);
+    ASSERT_EQ(4, contours[0].points.size());
+    ASSERT_EQ(Point(10, 20), contours[0].points[0]);
+    ASSERT_EQ(Point(10, 60), contours[0].points[1]);
+    ASSERT_EQ(Point(40, 60), contours[0].points[2]);
+    ASSERT_EQ(Point(40, 20), contours[0].points[3]);
+    ASSERT_NEAR(-1200, signedArea(contours[0]), 1e-3);
+}
+
+TEST_F(SGTessellationTest, RoundedRect)
+{
+    auto path = sg::path(Rect{0, 0, 100, 100}, 20);
+    auto contours = sg::flattenPath(*path, Transform2D(), 0.25f);
+    ASSERT_EQ(1, contours.size());
+
+    // Every point lies on the boundary of the rounded rectangle
+    for (const auto& p : contours[0].points) {
+        ASSERT_TRUE(p.getX() >= 0 && p.getX() <= 100 && p.getY() >= 0 && p.getY() <= 100) << p;
+        auto dx = std::max(std::abs(p.getX() - 50) - 30, 0.0f);
+        auto dy = std::max(std::abs(p.getY() - 50) - 30, 0.0f);
+        if (dx > 0 && dy > 0)
+            ASSERT_NEAR(20, std::sqrt(dx * dx + dy * dy), 1e-3) << p;
+    }
+
+    // The area is within tolerance of the true area (the chords cut inside the arcs)
+    auto expected = 100 * 100 - (4 - M_PI) * 20 * 20;
+    ASSERT_NEAR(expected, -signedArea(contours[0]), 0.25 * 4 * M_PI * 20 / 2);
+
+    // Drawing the path larger requires more segments
+    auto scaled = sg::flattenPath(*path, Transform2D::scale(4), 0.25f);
+    ASSERT_GT(scaled[0].points.size(), contours[0].points.size());
+}
+
+TEST_F(SGTessellationTest, Frame)
+{
+    auto contours = sg::flattenPath(*sg::path(RoundedRect({0, 0, 100, 100}, 10), 5), Transform2D(), 0.25f);
+    ASSERT_EQ(2, contours.size());
+
+    // The inner contour winds the other way so that the frame fills correctly
+    auto outer = signedArea(contours[0]);
+    auto inner = signedArea(contours[1]);
+    ASSERT_LT(outer, 0);
+    ASSERT_GT(inner, 0);
+    ASSERT_LT(-outer - inner, 100 * 100 - 90 * 90);
+}
+
+TEST_F(SGTessellationTest, GeneralPath)
+{
+    auto contours = sg::flattenPath(*sg::path("M0,0 Q50,100 100,0 Z M200,0 C200,50 300,50 300,0 L300,100"),
+                                    Transform2D(), 0.25f);
+    ASSERT_EQ(2, contours.size());
+
+    // Quadratic curve, closed
+    const auto& quad = contours[0];
+    ASSERT_TRUE(quad.closed);
+    ASSERT_EQ(Point(0, 0), quad.points.front());
+    ASSERT_EQ(Point(100, 0), quad.points.back());
+    ASSERT_GT(quad.points.size(), 10);
+    for (const auto& p : quad.points) {
+        // y = 2 * t * (1-t) * 100 where x = 100 * t
+        auto t = p.getX() / 100;
+        ASSERT_NEAR(200 * t * (1 - t), p.getY(), 1e-3) << p;
+    }
+
+    // Cubic curve followed by a line, open
+    const auto& cubic = contours[1];
+    ASSERT_FALSE(cubic.closed);
+    ASSERT_EQ(Point(200, 0), cubic.points.front());
+    ASSERT_EQ(Point(300, 100), cubic.points.back());
+    ASSERT_EQ(Point(300, 0), cubic.points.at(cubic.points.size() - 2));
+}
+
+TEST_F(SGTessellationTest, StrokeButt)
+{
+    auto paint = sg::paint(Color(Color::BLACK));
+    auto stroke = asStroke(sg::stroke(paint).strokeWidth(10).get());
+    auto contours = sg::flattenPath(*sg::path("M0,0 L100,0"), Transform2D(), 0.25f);
+
+    auto outline = sg::strokeContours(contours, *stroke, Transform2D(), 0.25f);
+    ASSERT_EQ(1, outline.size());
+    ASSERT_NEAR(1000, totalArea(outline), 1e-3);
+
+    // All polygons share the same orientation
+    for (const auto& m : outline)
+        ASSERT_GT(signedArea(m), 0);
+}
+
+TEST_F(SGTessellationTest, StrokeCapsAndJoins)
+{
+    auto paint = sg::paint(Color(Color::BLACK));
+    auto contours = sg::flattenPath(*sg::path("M0,0 L100,0 L100,100"), Transform2D(), 0.25f);
+
+    // Two segments, two square caps, one miter join
+    auto square = asStroke(sg::stroke(paint).strokeWidth(10).lineCap(kGraphicLineCapSquare)
+                      .lineJoin(kGraphicLineJoinMiter).get());
+    auto outline = sg::strokeContours(contours, *square, Transform2D(), 0.25f);
+    ASSERT_EQ(5, outline.size());
+    ASSERT_NEAR(2000 + 2 * 50 + 25, totalArea(outline), 1e-3);
+
+    // A tight miter limit falls back to a bevel
+    auto bevel = asStroke(sg::stroke(paint).strokeWidth(10).lineJoin(kGraphicLineJoinMiter).miterLimit(1).get());
+    outline = sg::strokeContours(contours, *bevel, Transform2D(), 0.25f);
+    ASSERT_EQ(3, outline.size());
+    ASSERT_NEAR(2000 + 12.5, totalArea(outline), 1e-3);
+
+    // Round caps and joins are circles
+    auto round = asStroke(sg::stroke(paint).strokeWidth(10).lineCap(kGraphicLineCapRound)
+                     .lineJoin(kGraphicLineJoinRound).get());
+    outline = sg::strokeContours(contours, *round, Transform2D(), 0.25f);
+    ASSERT_EQ(5, outline.size());
+    ASSERT_NEAR(2000 + 3 * M_PI * 25, totalArea(outline), 3 * 2 * M_PI * 5 * 0.25);
+}
+
+TEST_F(SGTessellationTest, StrokeDashes)
+{
+    auto paint = sg::paint(Color(Color::BLACK));
+    auto contours = sg::flattenPath(*sg::path("M0,0 L100,0"), Transform2D(), 0.25f);
+
+    auto dashed = asStroke(sg::stroke(paint).strokeWidth(2).dashes(Object(ObjectArray{10, 10})).get());
+    auto outline = sg::strokeContours(contours, *dashed, Transform2D(), 0.25f);
+    ASSERT_EQ(5, outline.size());
+    ASSERT_NEAR(100, totalArea(outline), 1e-3);
+
+    // The offset shifts the pattern, leaving a partial dash at each end
+    auto offset = asStroke(sg::stroke(paint).strokeWidth(2).dashes(Object(ObjectArray{10, 10})).dashOffset(5).get());
+    outline = sg::strokeContours(contours, *offset, Transform2D(), 0.25f);
+    ASSERT_EQ(6, outline.size());
+    ASSERT_NEAR(100, totalArea(outline), 1e-3);
+
+    // The path length scales the dash pattern
+    auto scaled = asStroke(sg::stroke(paint).strokeWidth(2).dashes(Object(ObjectArray{10, 10})).pathLength(50).get());
+    outline = sg::strokeContours(contours, *scaled, Transform2D(), 0.25f);
+    ASSERT_EQ(3, outline.size());
+    ASSERT_NEAR(120, totalArea(outline), 1e-3);
+}
+
+TEST_F(SGTessellationTest, CacheReuse)
+{
+    sg::TessellationCache cache;
+    auto path = sg::path("M0,0 Q50,100 100,0");
+
+    auto a = cache.fill(path, Transform2D());
+    ASSERT_EQ(1, cache.misses());
+
+    // Translation and changes of scale within the same bucket reuse the same geometry
+    ASSERT_EQ(a, cache.fill(path, Transform2D::translate(30, 40)));
+    ASSERT_EQ(a, cache.fill(path, Transform2D::scale(0.9f)));
+    ASSERT_EQ(2, cache.hits());
+    ASSERT_EQ(1, cache.size());
+
+    // A large change of scale builds new geometry
+    auto b = cache.fill(path, Transform2D::scale(4));
+    ASSERT_NE(a, b);
+    ASSERT_GT(b->at(0).points.size(), a->at(0).points.size());
+
+    // Strokes are cached separately from fills and by stroke parameters
+    auto paint = sg::paint(Color(Color::BLACK));
+    auto thin = cache.stroke(path, *asStroke(sg::stroke(paint).strokeWidth(1).get()), Transform2D());
+    auto thick = cache.stroke(path, *asStroke(sg::stroke(paint).strokeWidth(5).get()), Transform2D());
+    ASSERT_NE(thin, thick);
+    ASSERT_EQ(thin, cache.stroke(path, *asStroke(sg::stroke(paint).strokeWidth(1).get()), Transform2D()));
+    ASSERT_EQ(4, cache.size());
+}
+
+TEST_F(SGTessellationTest, CacheInvalidation)
+{
+    sg::TessellationCache cache(2);
+    auto path = sg::path(Rect{0, 0, 10, 10});
+
+    auto a = cache.fill(path, Transform2D());
+    ASSERT_EQ(a, cache.fill(path, Transform2D()));
+
+    // Modifying the path discards the cached geometry
+    ASSERT_TRUE(sg::RectPath::cast(path)->setRect(Rect{0, 0, 20, 20}));
+    auto b = cache.fill(path, Transform2D());
+    ASSERT_NE(a, b);
+    ASSERT_EQ(Point(20, 20), b->at(0).points[2]);
+    ASSERT_EQ(1, cache.size());
+
+    // Released paths are removed by clean()
+    auto other = sg::path(Rect{0, 0, 5, 5});
+    cache.fill(other, Transform2D());
+    ASSERT_EQ(2, cache.size());
+    other.reset();
+    cache.clean();
+    ASSERT_EQ(1, cache.size());
+
+    // The least recently used entry is evicted
+    auto p1 = sg::path(Rect{0, 0, 1, 1});
+    auto p2 = sg::path(Rect{0, 0, 2, 2});
+    cache.fill(p1, Transform2D());
+    cache.fill(path, Transform2D());
+    cache.fill(p2, Transform2D());
+    ASSERT_EQ(2, cache.size());
+    auto misses = cache.misses();
+    cache.fill(path, Transform2D());
+    ASSERT_EQ(misses, cache.misses());
+    cache.fill(p1, Transform2D());
+    ASSERT_EQ(misses + 1, cache.misses());
+
+    cache.clear();
+    ASSERT_EQ(0, cache.size());
+}
@@ -1201,7 +1201,7 @@ MouseDown(const RootContextPtr& root, const CoreComponentPtr& comp, double x, do
     root->handlePointerEvent(PointerEvent(kPointerDown, point));
 
     auto visitor = TouchableAtPosition(point);
-    CoreComponent::cast(root->topComponent())->raccept(visitor);
+    CoreComponent::cast(root->topComponent())->rsearch(visitor);
     auto target = CoreComponent::cast(visitor.getResult());
 
     if (target != comp)
@@ -1217,7 +1217,7 @@ MouseUp(const RootContextPtr& root, const CoreComponentPtr& comp, double x, doub
     root->handlePointerEvent(PointerEvent(kPointerUp, point));
 
     auto visitor = TouchableAtPosition(point);
-    CoreComponent::cast(root->topComponent())->raccept(visitor);
+    CoreComponent::cast(root->topComponent())->rsearch(visitor);
     auto target = CoreComponent::cast(visitor.getResult());
 
     if (target != comp)
@@ -1233,7 +1233,7 @@ MouseDown(const RootContextPtr& root, double x, double y) {
     root->handlePointerEvent(PointerEvent(kPointerDown, point));
 
     auto visitor = TouchableAtPosition(point);
-    CoreComponent::cast(root->topComponent())->raccept(visitor);
+    CoreComponent::cast(root->topComponent())->rsearch(visitor);
     auto target = CoreComponent::cast(visitor.getResult());
 
     if (!target)
@@ -1249,7 +1249,7 @@ MouseUp(const RootContextPtr& root, double x, double y) {
     root->handlePointerEvent(PointerEvent(kPointerUp, point));
 
     auto visitor = TouchableAtPosition(point);
-    CoreComponent::cast(root->topComponent())->raccept(visitor);
+    CoreComponent::cast(root->topComponent())->rsearch(visitor);
     auto target = CoreComponent::cast(visitor.getResult());
 
     if (!target)
@@ -1265,7 +1265,7 @@ MouseMove(const RootContextPtr& root, double x, double y) {
     root->handlePointerEvent(PointerEvent(kPointerMove, point));
 
     auto visitor = TouchableAtPosition(point);
-    CoreComponent::cast(root->topComponent())->raccept(visitor);
+    CoreComponent::cast(root->topComponent())->rsearch(visitor);
     auto target = CoreComponent::cast(visitor.getResult());
 
     if (!target)
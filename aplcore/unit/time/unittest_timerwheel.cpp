@@ -0,0 +1,155 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "../testeventloop.h"
+
+#include "apl/time/timerwheel.h"
+
+using namespace apl;
+
+static TimerQueueEntry
+makeEntry(timeout_id id, apl_time_t start, apl_duration_t duration)
+{
+    return {nullptr, TimerQueueEntry::NO_SLOT, start, duration, id};
+}
+
+TEST(TimerWheelTest, Basic)
+{
+    TimerWheel wheel;
+    ASSERT_EQ(0, wheel.size());
+    ASSERT_EQ(std::numeric_limits<apl_time_t>::max(), wheel.nextTime());
+
+    wheel.push(makeEntry(1, 0, 500));
+    wheel.push(makeEntry(2, 0, 20.5));
+    wheel.push(makeEntry(3, 0, 20.25));
+    wheel.push(makeEntry(4, 0, 100000));
+    ASSERT_EQ(4, wheel.size());
+    ASSERT_EQ(20.25, wheel.nextTime());
+
+    ASSERT_TRUE(wheel.remove(3, nullptr));
+    ASSERT_FALSE(wheel.remove(3, nullptr));
+    ASSERT_EQ(20.5, wheel.nextTime());
+
+    ASSERT_EQ(2, wheel.pop().id);
+    ASSERT_EQ(1, wheel.pop().id);
+
+    TimerQueueEntry removed;
+    ASSERT_TRUE(wheel.remove(4, &removed));
+    ASSERT_EQ(100000, removed.endTime);
+    ASSERT_EQ(0, wheel.size());
+}
+
+TEST(TimerWheelTest, SameEndTimeLeavesInOrder)
+{
+    TimerWheel wheel;
+    for (timeout_id id = 1 ; id <= 5 ; id++)
+        wheel.push(makeEntry(id, 0, 5000));
+
+    for (timeout_id id = 1 ; id <= 5 ; id++)
+        ASSERT_EQ(id, wheel.pop().id);
+}
+
+TEST(TimerWheelTest, PastTimeout)
+{
+    TimerWheel wheel;
+    wheel.push(makeEntry(1, 0, 1000));
+    wheel.push(makeEntry(2, 0, 2000));
+    ASSERT_EQ(1, wheel.pop().id);
+
+    // A timeout that already expired (for example, a rehydrated one) is next
+    wheel.push(makeEntry(3, 0, 500));
+    ASSERT_EQ(500, wheel.nextTime());
+    ASSERT_EQ(3, wheel.pop().id);
+    ASSERT_EQ(2, wheel.pop().id);
+}
+
+/**
+ * Compare against the heap with a long run of random timeouts, including ones beyond the top level
+ * of the wheel, and timeouts added and removed while others leave.
+ */
+TEST(TimerWheelTest, MatchesHeap)
+{
+    HeapTimerQueue heap;
+    TimerWheel wheel;
+
+    std::uint32_t seed = 12345;
+    auto random = [&](std::uint32_t range) {
+        seed = seed * 1664525 + 1013904223;
+        return (seed >> 8) % range;
+    };
+
+    static const std::uint32_t RANGES[] = {10, 1000, 100000, 50000000};
+
+    apl_time_t now = 0;
+    timeout_id nextId = 1;
+    std::vector<timeout_id> live;
+
+    for (int step = 0 ; step < 20000 ; step++) {
+        auto action = random(10);
+        if (action < 5) {
+            // Unique fractional end times keep the heap order well defined
+            auto duration = random(RANGES[random(4)]) + static_cast<double>(nextId) / 1e6;
+            heap.push(makeEntry(nextId, now, duration));
+            wheel.push(makeEntry(nextId, now, duration));
+            live.emplace_back(nextId++);
+        } else if (action < 7 && !live.empty()) {
+            auto index = random(live.size());
+            auto id = live[index];
+            live.erase(live.begin() + index);
+            ASSERT_TRUE(heap.remove(id, nullptr));
+            ASSERT_TRUE(wheel.remove(id, nullptr));
+        } else if (heap.size() > 0) {
+            ASSERT_EQ(heap.nextTime(), wheel.nextTime()) << step;
+            auto expected = heap.pop();
+            auto actual = wheel.pop();
+            ASSERT_EQ(expected.id, actual.id) << step;
+            now = actual.endTime;
+            live.erase(std::find(live.begin(), live.end(), actual.id));
+        }
+
+        ASSERT_EQ(heap.size(), wheel.size());
+    }
+
+    while (heap.size() > 0)
+        ASSERT_EQ(heap.pop().id, wheel.pop().id);
+    ASSERT_EQ(0, wheel.size());
+}
+
+TEST(TimerWheelTest, SelectedThroughRootConfig)
+{
+    auto config = RootConfig::create();
+    config->timerBackend(RootConfig::kTimerBackendWheel);
+    auto timeManager = config->getTimeManager();
+
+    std::vector<int> fired;
+    timeManager->setTimeout([&]() { fired.emplace_back(2); }, 200);
+    auto cancelled = timeManager->setTimeout([&]() { fired.emplace_back(3); }, 150);
+    timeManager->setTimeout([&]() { fired.emplace_back(1); }, 100);
+
+    int animatorCalls = 0;
+    timeManager->setAnimator([&](apl_duration_t) { animatorCalls++; }, 300);
+
+    ASSERT_EQ(4, timeManager->size());
+    ASSERT_TRUE(timeManager->clearTimeout(cancelled));
+    ASSERT_EQ(1, timeManager->nextTimeout());
+
+    timeManager->updateTime(250);
+    ASSERT_EQ(std::vector<int>({1, 2}), fired);
+    ASSERT_EQ(1, animatorCalls);
+
+    timeManager->updateTime(400);
+    ASSERT_EQ(2, animatorCalls);
+    ASSERT_EQ(0, timeManager->size());
+}
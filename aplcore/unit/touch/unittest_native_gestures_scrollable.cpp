@@ -373,6 +373,72 @@ TEST_F(NativeGesturesScrollableTest, ScrollFlingGestureUpEventWithoutFault) {
     ASSERT_EQ(Point(0, 900), component->scrollPosition());
 }
 
+/**
+ * Pointer samples delivered in batches, one batch per frame, scroll with the last sample of each frame and fling with
+ * the velocity of all the samples.  The drag slows down, so a velocity taken from one sample per frame would differ.
+ */
+TEST_F(NativeGesturesScrollableTest, ScrollBatchedMoves)
+{
+    // Samples taken every 4 milliseconds, delivered once every 16 milliseconds
+    const int SAMPLES = 24;
+    const int PERIOD = 4;
+    const int PER_FRAME = 4;
+    auto offset = [](int i) { return 1.5f * i - i * i / 96.0f; };
+
+    loadDocument(SCROLL_TEST);
+
+    // Reference: the same samples delivered one at a time
+    ASSERT_TRUE(HandlePointerEvent(root, PointerEventType::kPointerDown, Point(0, 250), false, "onDown:yellow2"));
+    for (int i = 1 ; i <= SAMPLES ; i++) {
+        advanceTime(PERIOD);
+        root->handlePointerEvent(PointerEvent(kPointerMove, Point(0, 250 - offset(i))));
+    }
+    ASSERT_TRUE(root->handlePointerEvent(PointerEvent(kPointerUp, Point(0, 250 - offset(SAMPLES)))));
+    auto released = component->scrollPosition().getY();
+    advanceTime(3000);
+    auto flung = component->scrollPosition().getY() - released;
+    ASSERT_LT(0, flung);
+    ASSERT_GT(900, component->scrollPosition().getY());
+
+    component->update(kUpdateScrollPosition, 0);
+    root->clearPending();
+    while (root->hasEvent())
+        root->popEvent();
+
+    ASSERT_TRUE(HandlePointerEvent(root, PointerEventType::kPointerDown, Point(0, 250), false, "onDown:yellow2"));
+    auto previous = component->scrollPosition().getY();
+    for (int frame = 0 ; frame < SAMPLES / PER_FRAME ; frame++) {
+        advanceTime(PERIOD * PER_FRAME);
+        auto now = root->currentTime();
+        std::vector<PointerSample> samples;
+        for (int j = 1 ; j <= PER_FRAME ; j++)
+            samples.emplace_back(PointerEvent(kPointerMove, Point(0, 250 - offset(frame * PER_FRAME + j))),
+                                 now - PERIOD * (PER_FRAME - j));
+        root->handlePointerEvents(samples);
+
+        // Once scrolling, each frame moves by the distance covered by all of its samples
+        auto position = component->scrollPosition().getY();
+        if (previous > 0)
+            ASSERT_NEAR(offset((frame + 1) * PER_FRAME) - offset(frame * PER_FRAME), position - previous, 0.01);
+        previous = position;
+
+        // At most the last move of a frame reaches the TouchWrapper
+        int moves = 0;
+        while (root->hasEvent()) {
+            auto event = root->popEvent();
+            if (event.getType() == kEventTypeSendEvent &&
+                event.getValue(kEventPropertyArguments).getArray().at(0).asString() == "onMove:yellow2")
+                moves++;
+        }
+        ASSERT_GE(1, moves);
+    }
+    ASSERT_LT(0, previous);
+
+    ASSERT_TRUE(root->handlePointerEvents({{PointerEvent(kPointerUp, Point(0, 250 - offset(SAMPLES))), root->currentTime()}}));
+    advanceTime(3000);
+    ASSERT_NEAR(flung, component->scrollPosition().getY() - previous, 1);
+}
+
 TEST_F(NativeGesturesScrollableTest, ScrollFlingGestureUpEventFault) {
     loadDocument(SCROLL_TEST);
 
@@ -655,6 +655,33 @@ TEST_F(PointerTest, TouchWrapperMoveEventPropertiesSingularity) {
     ASSERT_FALSE(root->hasEvent());
 }
 
+/**
+ * Consecutive moves in a batch reach the component once, at the last position.
+ */
+TEST_F(PointerTest, TouchWrapperBatchedMoves) {
+    loadDocument(TOUCH_WRAPPER_MOUSE_EVENT);
+
+    auto now = root->currentTime();
+    ASSERT_FALSE(root->handlePointerEvents({
+        {PointerEvent(kPointerDown, Point(60, 40)), now},
+        {PointerEvent(kPointerMove, Point(58, 40)), now},
+        {PointerEvent(kPointerMove, Point(54, 40)), now},
+        {PointerEvent(kPointerMove, Point(50, 40)), now},
+    }));
+    ASSERT_TRUE(CheckSendEvent(root, "MouseMove", 40, 30, 100, 60, true));
+    ASSERT_FALSE(root->hasEvent());
+
+    // A move followed by an up is not coalesced
+    root->handlePointerEvents({
+        {PointerEvent(kPointerMove, Point(300, 300)), now},
+        {PointerEvent(kPointerMove, Point(410, 410)), now},
+        {PointerEvent(kPointerUp, Point(410, 410)), now},
+    });
+    ASSERT_TRUE(CheckSendEvent(root, "MouseMove", 400, 400, 100, 60, false));
+    ASSERT_TRUE(CheckSendEvent(root, "MouseUp", 400, 400, 100, 60, false));
+    ASSERT_FALSE(root->hasEvent());
+}
+
 /**
  * Verify that the event properties when a TouchWrapper is transformed are relative to the
  * component's bounding box (i.e. original size), not the transformed/rendered size.
@@ -215,3 +215,110 @@ TEST_F(EventLoopWrapper, AnimatorCreatesTimeout)
 
     ASSERT_EQ(2, timeoutCalls);
 }
+
+TEST_F(EventLoopWrapper, AnimatorClearsAnimator)
+{
+    timeout_id second = 0;
+    int firstCalls = 0, secondCalls = 0;
+
+    loop->setAnimator([&](apl_duration_t delta) {
+        firstCalls++;
+        if (second) {
+            loop->clearTimeout(second);
+            second = 0;
+        }
+    }, 1000);
+    second = loop->setAnimator([&](apl_duration_t delta) {
+        secondCalls++;
+    }, 1000);
+
+    // The cleared animator is skipped in the tick that cleared it
+    loop->advanceBy(100);
+    ASSERT_EQ(1, firstCalls);
+    ASSERT_EQ(0, secondCalls);
+    ASSERT_EQ(1, loop->animatorCount());
+
+    loop->advanceToEnd();
+    ASSERT_EQ(0, secondCalls);
+    ASSERT_EQ(0, loop->animatorCount());
+}
+
+TEST_F(EventLoopWrapper, AnimatorClearsItself)
+{
+    timeout_id id = 0;
+    int calls = 0;
+    id = loop->setAnimator([&](apl_duration_t delta) {
+        calls++;
+        loop->clearTimeout(id);
+    }, 1000);
+
+    loop->advanceBy(100);
+    loop->advanceBy(100);
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(0, loop->animatorCount());
+    ASSERT_EQ(0, loop->size());
+}
+
+TEST_F(EventLoopWrapper, AnimatorAddsAnimator)
+{
+    std::vector<apl_duration_t> added;
+    bool first = true;
+
+    loop->setAnimator([&](apl_duration_t delta) {
+        if (first) {
+            first = false;
+            loop->setAnimator([&](apl_duration_t delta) {
+                added.emplace_back(delta);
+            }, 300);
+        }
+    }, 1000);
+
+    // The new animator starts on the next tick
+    loop->advanceBy(100);
+    ASSERT_TRUE(added.empty());
+    ASSERT_EQ(2, loop->animatorCount());
+
+    loop->advanceBy(100);
+    loop->advanceBy(300);
+    ASSERT_EQ(std::vector<apl_duration_t>({100, 300}), added);
+    ASSERT_EQ(1, loop->animatorCount());
+
+    loop->advanceToEnd();
+    ASSERT_EQ(0, loop->animatorCount());
+}
+
+TEST_F(EventLoopWrapper, FrozenAnimator)
+{
+    std::vector<apl_duration_t> values;
+    auto id = loop->setAnimator([&](apl_duration_t delta) {
+        values.emplace_back(delta);
+    }, 1000);
+
+    loop->advanceBy(100);
+    loop->freeze(id);
+    ASSERT_EQ(0, loop->size());
+    loop->advanceBy(100);
+    ASSERT_EQ(std::vector<apl_duration_t>({100}), values);
+
+    ASSERT_TRUE(loop->rehydrate(id));
+    loop->advanceBy(100);
+    ASSERT_EQ(std::vector<apl_duration_t>({100, 300}), values);
+    loop->clearTimeout(id);
+}
+
+TEST_F(EventLoopWrapper, AnimatorSlotsAreReused)
+{
+    int oldCalls = 0, newCalls = 0;
+    auto id = loop->setAnimator([&](apl_duration_t delta) { oldCalls++; }, 1000);
+    ASSERT_TRUE(loop->clearTimeout(id));
+
+    loop->setAnimator([&](apl_duration_t delta) { newCalls++; }, 1000);
+    loop->advanceBy(100);
+    ASSERT_EQ(0, oldCalls);
+    ASSERT_EQ(1, newCalls);
+
+    ASSERT_FALSE(loop->clearTimeout(id));
+    loop->advanceBy(900);
+    ASSERT_EQ(2, newCalls);
+    ASSERT_EQ(0, loop->size());
+}
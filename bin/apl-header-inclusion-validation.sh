@@ -30,6 +30,8 @@ public_apl_headers=(
     "apl/common.h"
     "apl/component/component.h"
     "apl/component/componentproperties.h"
+    "apl/component/dirtypropertydecoder.h"
+    "apl/component/dirtypropertyencoder.h"
     "apl/component/textmeasurement.h"
     "apl/content/aplversion.h"
     "apl/content/configurationchange.h"
@@ -55,6 +57,7 @@ public_apl_headers=(
     "apl/datasource/dynamiclistdatasourcecommon.h"
     "apl/datasource/dynamiclistdatasourceprovider.h"
     "apl/datasource/dynamictokenlistdatasourceprovider.h"
+    "apl/datasource/fetchscheduler.h"
     "apl/datasource/offsetindexdatasourceconnection.h"
     "apl/document/displaystate.h"
     "apl/document/documentcontext.h"
@@ -88,10 +91,13 @@ public_apl_headers=(
     "apl/graphic/graphicfilter.h"
     "apl/graphic/graphicpattern.h"
     "apl/graphic/graphicproperties.h"
+    "apl/livedata/chunkedobjectarray.h"
+    "apl/livedata/columnarbatch.h"
     "apl/livedata/livearray.h"
     "apl/livedata/livedataobjectwatcher.h"
     "apl/livedata/livemap.h"
     "apl/livedata/liveobject.h"
+    "apl/livedata/liveproducer.h"
     "apl/media/mediamanager.h"
     "apl/media/mediaobject.h"
     "apl/media/mediaplayer.h"
@@ -137,6 +143,7 @@ public_apl_headers=(
     "apl/scenegraph/scenegraph.h"
     "apl/scenegraph/scenegraphupdates.h"
     "apl/scenegraph/shadow.h"
+    "apl/scenegraph/tessellation.h"
     "apl/scenegraph/textchunk.h"
     "apl/scenegraph/textlayout.h"
     "apl/scenegraph/textmeasurement.h"
@@ -147,7 +154,9 @@ public_apl_headers=(
     "apl/utils/counter.h"
     "apl/utils/deprecated.h"
     "apl/utils/localemethods.h"
+    "apl/utils/jsonsink.h"
     "apl/utils/log.h"
+    "apl/utils/mpscqueue.h"
     "apl/utils/noncopyable.h"
     "apl/utils/path.h"
     "apl/utils/session.h"
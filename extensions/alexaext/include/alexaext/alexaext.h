@@ -45,6 +45,7 @@
 #include "extensionregistrar.h"
 #include "localextensionproxy.h"
 #include "sessiondescriptor.h"
+#include "threadpoolexecutor.h"
 #include "types.h"
 #include "APLAudioPlayerExtension/AplAudioPlayerExtension.h"
 #include "APLAudioNormalizationExtension/AplAudioNormalizationExtension.h"
@@ -19,6 +19,8 @@
 #include <functional>
 #include <memory>
 
+#include "activitydescriptor.h"
+
 namespace alexaext {
 
 /**
@@ -40,6 +42,24 @@ public:
      */
     virtual bool enqueueTask(Task task) = 0;
 
+    /**
+     * Enqueues a task on behalf of an activity. Tasks enqueued for the same activity run in the
+     * order they were enqueued. The default implementation defers to enqueueTask.
+     *
+     * @param activity The activity the task belongs to
+     * @param task The task to execute
+     * @return @c true if the task was successfully enqueued (or executed), @c false otherwise
+     */
+    virtual bool enqueueActivityTask(const ActivityDescriptor& activity, Task task) {
+        return enqueueTask(std::move(task));
+    }
+
+    /**
+     * @return @c true if enqueued tasks always run before enqueueTask returns. Callers may then pass
+     *         data the task only borrows for the duration of the call.
+     */
+    virtual bool isSynchronous() const { return false; }
+
     /**
      * @return A shared instance of a synchronous executor.
      */
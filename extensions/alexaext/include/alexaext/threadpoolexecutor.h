@@ -0,0 +1,142 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef _ALEXAEXT_THREAD_POOL_EXECUTOR_H
+#define _ALEXAEXT_THREAD_POOL_EXECUTOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "executor.h"
+
+namespace alexaext {
+
+/**
+ * Executor that runs tasks on a fixed set of worker threads.
+ *
+ * Tasks enqueued for the same activity (or the same key) run one at a time, in the order they were
+ * enqueued.  Tasks for different activities run in parallel, so an extension doing slow work for
+ * one activity does not hold up the others.  Tasks enqueued without an activity have no ordering
+ * guarantee.
+ *
+ * Each worker keeps its own queue of runnable activities.  A worker that runs out of work takes
+ * an activity from the queue of another worker.  An activity with more tasks waiting goes to the
+ * back of the queue of the worker that ran it after each task, so busy activities share the workers
+ * fairly.
+ *
+ * Tasks are responsible for the lifetime of what they use; the usual pattern is to capture a weak
+ * pointer to the extension or proxy and to skip the work when it has gone away.
+ */
+class ThreadPoolExecutor final : public Executor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Load of the executor, used to apply backpressure to the producers of tasks.
+     */
+    struct Metrics {
+        /// Number of tasks enqueued but not started yet.
+        size_t queueDepth = 0;
+        /// Largest queue depth seen so far.
+        size_t maxQueueDepth = 0;
+        /// Number of tasks that have run to completion.
+        size_t executed = 0;
+        /// Average time between enqueueing a task and starting it.
+        std::chrono::microseconds averageLatency{0};
+        /// Longest time between enqueueing a task and starting it.
+        std::chrono::microseconds maxLatency{0};
+    };
+
+    /**
+     * Create an executor and start its worker threads.
+     *
+     * @param threads Number of worker threads.  Zero uses the number of hardware threads.
+     * @return The executor.
+     */
+    static std::shared_ptr<ThreadPoolExecutor> create(size_t threads = 0);
+
+    explicit ThreadPoolExecutor(size_t threads);
+
+    /**
+     * Shuts the executor down, see shutdown().
+     */
+    ~ThreadPoolExecutor() override;
+
+    bool enqueueTask(Task task) override;
+    bool enqueueActivityTask(const ActivityDescriptor& activity, Task task) override;
+
+    /**
+     * Enqueues a task that runs after all the tasks previously enqueued with the same key.
+     *
+     * @param key The ordering key, for example an extension URI.
+     * @param task The task to execute.
+     * @return @c true if the task was enqueued, @c false if the executor has been shut down.
+     */
+    bool enqueueOrderedTask(const std::string& key, Task task);
+
+    /**
+     * Stops accepting tasks, runs the tasks already enqueued and waits for the worker threads to
+     * exit.  Tasks running on the executor may still enqueue follow-up tasks until it has drained.
+     * Does nothing when called from a task running on this executor.
+     */
+    void shutdown();
+
+    /**
+     * @return The number of worker threads.
+     */
+    size_t getThreadCount() const { return mWorkers.size(); }
+
+    /**
+     * @return A snapshot of the load of the executor.
+     */
+    Metrics getMetrics() const;
+
+private:
+    struct Strand;
+    struct Worker;
+    using StrandPtr = std::shared_ptr<Strand>;
+
+    bool enqueue(const std::string* key, Task&& task);
+    StrandPtr take(size_t index);
+    void run(size_t index);
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::mutex mShutdownMutex;
+
+    // Guards the worker queues and everything below
+    mutable std::mutex mMutex;
+    std::condition_variable mWakeUp;
+    std::unordered_map<std::string, StrandPtr> mStrands;
+    size_t mRunnable = 0;       // Strands sitting in a worker queue
+    size_t mUnfinished = 0;     // Tasks enqueued and not completed
+    size_t mIdle = 0;           // Workers waiting for work
+    size_t mNextWorker = 0;
+    bool mStopping = false;
+    Metrics mMetrics;
+    size_t mStarted = 0;
+    Clock::duration mTotalLatency = Clock::duration::zero();
+};
+
+using ThreadPoolExecutorPtr = std::shared_ptr<ThreadPoolExecutor>;
+
+} // namespace alexaext
+
+#endif //_ALEXAEXT_THREAD_POOL_EXECUTOR_H
@@ -151,11 +151,12 @@ AplE2eEncryptionExtension::invokeCommand(const std::string& uri, const rapidjson
         const rapidjson::Value* params = Command::PAYLOAD().Get(command);
         if (!params || !params->HasMember(VALUE_PROPERTY) || !params->HasMember(ALGORITHM_PROPERTY))
             return false;
-        auto token = GetWithDefault(TOKEN_PROPERTY, params, "");
-        auto value = GetWithDefault(VALUE_PROPERTY, params, "");
-        auto key = GetWithDefault(KEY_PROPERTY, params, "");
-        auto algorithm = GetWithDefault(ALGORITHM_PROPERTY, params, "");
-        auto aad = GetWithDefault(AAD_PROPERTY, params, "");
+        // Copied, the task may run after the command has been released
+        std::string token = GetWithDefault(TOKEN_PROPERTY, params, "");
+        std::string value = GetWithDefault(VALUE_PROPERTY, params, "");
+        std::string key = GetWithDefault(KEY_PROPERTY, params, "");
+        std::string algorithm = GetWithDefault(ALGORITHM_PROPERTY, params, "");
+        std::string aad = GetWithDefault(AAD_PROPERTY, params, "");
         auto base64Encoded = GetWithDefault(BASE64_ENCODED_PROPERTY, params, false);
         auto thisWeakPointer = std::weak_ptr<AplE2eEncryptionExtension>(shared_from_this());
         auto successCallback = [thisWeakPointer](const std::string& token,
@@ -192,9 +193,10 @@ AplE2eEncryptionExtension::invokeCommand(const std::string& uri, const rapidjson
                              .property(ERROR_REASON_PROPERTY, reason);
             ptr->invokeExtensionEventHandler(URI, event);
         };
-        executor->enqueueTask([&](){
-            mObserver->onBase64EncryptValue(token, key, algorithm, aad, value, base64Encoded,
-                                            successCallback, errorCallback);
+        auto observer = mObserver;
+        executor->enqueueTask([=](){
+            observer->onBase64EncryptValue(token, key, algorithm, aad, value, base64Encoded,
+                                           successCallback, errorCallback);
         });
         return true;
     }
@@ -203,8 +205,8 @@ AplE2eEncryptionExtension::invokeCommand(const std::string& uri, const rapidjson
         const rapidjson::Value* params = Command::PAYLOAD().Get(command);
         if (!params || !params->HasMember(VALUE_PROPERTY))
             return false;
-        auto token = GetWithDefault(TOKEN_PROPERTY, params, "");
-        auto value = GetWithDefault(VALUE_PROPERTY, params, "");
+        std::string token = GetWithDefault(TOKEN_PROPERTY, params, "");
+        std::string value = GetWithDefault(VALUE_PROPERTY, params, "");
         auto thisWeakPointer = std::weak_ptr<AplE2eEncryptionExtension>(shared_from_this());
         auto successCallback = [thisWeakPointer](const std::string& token,
                                                  const std::string& base64EncodedData) {
@@ -219,8 +221,9 @@ AplE2eEncryptionExtension::invokeCommand(const std::string& uri, const rapidjson
                              .property(BASE64_ENCODED_DATA_PROPERTY, base64EncodedData);
             ptr->invokeExtensionEventHandler(URI, event);
         };
-        executor->enqueueTask([&](){
-            return mObserver->onBase64EncodeValue(token, value, successCallback);
+        auto observer = mObserver;
+        executor->enqueueTask([=](){
+            observer->onBase64EncodeValue(token, value, successCallback);
         });
         return true;
     }
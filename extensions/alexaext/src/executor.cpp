@@ -26,6 +26,8 @@ public:
         task();
         return true;
     }
+
+    bool isSynchronous() const override { return true; }
 };
 
 
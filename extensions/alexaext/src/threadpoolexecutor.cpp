@@ -0,0 +1,260 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include "alexaext/threadpoolexecutor.h"
+
+namespace alexaext {
+
+/**
+ * The tasks of one ordering key.  A strand is either idle, waiting in exactly one worker queue,
+ * or running on exactly one worker, which is what keeps its tasks in order.
+ */
+struct ThreadPoolExecutor::Strand {
+    struct Entry {
+        Task task;
+        Clock::time_point enqueued;
+    };
+
+    explicit Strand(const std::string* key) : ordered(key != nullptr), key(key ? *key : "") {}
+
+    const bool ordered;
+    const std::string key;
+    std::deque<Entry> tasks;
+    bool scheduled = false;
+};
+
+struct ThreadPoolExecutor::Worker {
+    std::deque<StrandPtr> queue;
+    std::thread thread;
+};
+
+namespace {
+
+// The executor and worker running on the current thread.  Work scheduled from a task stays on
+// the worker that ran it.
+thread_local const ThreadPoolExecutor* sCurrentExecutor = nullptr;
+thread_local size_t sCurrentWorker = 0;
+
+std::string
+activityKey(const ActivityDescriptor& activity)
+{
+    auto session = activity.getSession();
+    return activity.getURI() + '\n' + (session ? session->getId() : "") + '\n' + activity.getId();
+}
+
+} // namespace
+
+std::shared_ptr<ThreadPoolExecutor>
+ThreadPoolExecutor::create(size_t threads)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    return std::make_shared<ThreadPoolExecutor>(threads);
+}
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t threads)
+{
+    threads = std::max<size_t>(1, threads);
+    for (size_t i = 0; i < threads; i++)
+        mWorkers.emplace_back(new Worker());
+
+    // Start the threads once the worker list is complete, as any worker may steal from any other
+    for (size_t i = 0; i < threads; i++)
+        mWorkers[i]->thread = std::thread(&ThreadPoolExecutor::run, this, i);
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor()
+{
+    shutdown();
+}
+
+bool
+ThreadPoolExecutor::enqueueTask(Task task)
+{
+    return enqueue(nullptr, std::move(task));
+}
+
+bool
+ThreadPoolExecutor::enqueueActivityTask(const ActivityDescriptor& activity, Task task)
+{
+    auto key = activityKey(activity);
+    return enqueue(&key, std::move(task));
+}
+
+bool
+ThreadPoolExecutor::enqueueOrderedTask(const std::string& key, Task task)
+{
+    return enqueue(&key, std::move(task));
+}
+
+bool
+ThreadPoolExecutor::enqueue(const std::string* key, Task&& task)
+{
+    if (!task)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // While draining, only the tasks still running may add follow-up work
+        if (mStopping && sCurrentExecutor != this)
+            return false;
+
+        StrandPtr strand;
+        if (key) {
+            auto& slot = mStrands[*key];
+            if (!slot)
+                slot = std::make_shared<Strand>(key);
+            strand = slot;
+        } else {
+            strand = std::make_shared<Strand>(nullptr);
+        }
+
+        strand->tasks.emplace_back(Strand::Entry{std::move(task), Clock::now()});
+        mUnfinished++;
+        mMetrics.queueDepth++;
+        mMetrics.maxQueueDepth = std::max(mMetrics.maxQueueDepth, mMetrics.queueDepth);
+
+        // Already waiting or running, the new task runs after the ones before it
+        if (strand->scheduled)
+            return true;
+
+        strand->scheduled = true;
+        auto index = sCurrentExecutor == this ? sCurrentWorker : mNextWorker++ % mWorkers.size();
+        mWorkers[index]->queue.emplace_back(std::move(strand));
+        mRunnable++;
+    }
+
+    mWakeUp.notify_one();
+    return true;
+}
+
+ThreadPoolExecutor::StrandPtr
+ThreadPoolExecutor::take(size_t index)
+{
+    if (mRunnable == 0)
+        return nullptr;
+
+    auto& own = mWorkers[index]->queue;
+    if (!own.empty()) {
+        auto strand = std::move(own.front());
+        own.pop_front();
+        mRunnable--;
+        return strand;
+    }
+
+    // Steal the most recent strand of the worker with the longest queue
+    Worker* victim = nullptr;
+    for (const auto& worker : mWorkers) {
+        if (!worker->queue.empty() && (!victim || worker->queue.size() > victim->queue.size()))
+            victim = worker.get();
+    }
+
+    auto strand = std::move(victim->queue.back());
+    victim->queue.pop_back();
+    mRunnable--;
+    return strand;
+}
+
+void
+ThreadPoolExecutor::run(size_t index)
+{
+    sCurrentExecutor = this;
+    sCurrentWorker = index;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        auto strand = take(index);
+        if (!strand) {
+            if (mStopping && mUnfinished == 0)
+                break;
+            mIdle++;
+            mWakeUp.wait(lock);
+            mIdle--;
+            continue;
+        }
+
+        auto task = std::move(strand->tasks.front().task);
+        auto latency = Clock::now() - strand->tasks.front().enqueued;
+        strand->tasks.pop_front();
+        mMetrics.queueDepth--;
+        mStarted++;
+        mTotalLatency += latency;
+        mMetrics.maxLatency = std::max(
+            mMetrics.maxLatency, std::chrono::duration_cast<std::chrono::microseconds>(latency));
+
+        lock.unlock();
+        task();
+        // Release whatever the task captured before taking the lock again
+        task = nullptr;
+        lock.lock();
+
+        mMetrics.executed++;
+        mUnfinished--;
+
+        if (strand->tasks.empty()) {
+            strand->scheduled = false;
+            if (strand->ordered) {
+                auto it = mStrands.find(strand->key);
+                if (it != mStrands.end() && it->second == strand)
+                    mStrands.erase(it);
+            }
+        } else {
+            // Let the other runnable strands have a turn before the next task of this one
+            mWorkers[index]->queue.emplace_back(std::move(strand));
+            mRunnable++;
+            if (mIdle > 0)
+                mWakeUp.notify_one();
+        }
+
+        if (mStopping && mUnfinished == 0)
+            mWakeUp.notify_all();
+    }
+}
+
+void
+ThreadPoolExecutor::shutdown()
+{
+    // A worker cannot wait for itself
+    if (sCurrentExecutor == this)
+        return;
+
+    std::lock_guard<std::mutex> guard(mShutdownMutex);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWakeUp.notify_all();
+
+    for (auto& worker : mWorkers) {
+        if (worker->thread.joinable())
+            worker->thread.join();
+    }
+}
+
+ThreadPoolExecutor::Metrics
+ThreadPoolExecutor::getMetrics() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto metrics = mMetrics;
+    if (mStarted > 0)
+        metrics.averageLatency =
+            std::chrono::duration_cast<std::chrono::microseconds>(mTotalLatency / mStarted);
+    return metrics;
+}
+
+} // namespace alexaext
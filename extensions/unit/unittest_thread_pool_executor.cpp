@@ -0,0 +1,256 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+#include <map>
+#include <mutex>
+
+#include <alexaext/alexaext.h>
+#include <alexaext/threadpoolexecutor.h>
+
+#include "gtest/gtest.h"
+
+using namespace alexaext;
+
+namespace {
+
+static const char *URI = "test:pool:1.0";
+
+static const std::chrono::seconds TIMEOUT(10);
+
+/**
+ * Records the commands it receives for each activity.
+ */
+class RecordingExtension final : public ExtensionBase {
+public:
+    RecordingExtension() : ExtensionBase(URI) {}
+
+    bool invokeCommand(const ActivityDescriptor& activity, const rapidjson::Value& command) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        received[activity.getId()].emplace_back(GetWithDefault<int>(Command::ID(), command, -1));
+        return true;
+    }
+
+    std::mutex mutex;
+    std::map<std::string, std::vector<int>> received;
+};
+
+} // namespace
+
+TEST(ThreadPoolExecutorTest, OrderedPerActivity)
+{
+    auto executor = ThreadPoolExecutor::create(4);
+    ASSERT_EQ(4, executor->getThreadCount());
+
+    auto session = SessionDescriptor::create();
+    std::vector<ActivityDescriptorPtr> activities;
+    for (int i = 0; i < 5; i++)
+        activities.emplace_back(ActivityDescriptor::create(URI, session));
+
+    std::mutex mutex;
+    std::map<std::string, std::vector<int>> order;
+    std::map<std::string, int> running;
+    std::atomic<int> overlaps(0);
+
+    for (int i = 0; i < 200; i++) {
+        for (const auto& activity : activities) {
+            auto id = activity->getId();
+            ASSERT_TRUE(executor->enqueueActivityTask(*activity, [&, id, i]() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (running[id]++ > 0)
+                        overlaps++;
+                    order[id].emplace_back(i);
+                }
+                std::this_thread::yield();
+                std::lock_guard<std::mutex> lock(mutex);
+                running[id]--;
+            }));
+        }
+    }
+
+    executor->shutdown();
+
+    ASSERT_EQ(0, overlaps);
+    ASSERT_EQ(5, order.size());
+    for (const auto& entry : order) {
+        ASSERT_EQ(200, entry.second.size());
+        for (int i = 0; i < 200; i++)
+            ASSERT_EQ(i, entry.second.at(i));
+    }
+    ASSERT_EQ(1000, executor->getMetrics().executed);
+}
+
+TEST(ThreadPoolExecutorTest, ActivitiesRunInParallel)
+{
+    auto executor = ThreadPoolExecutor::create(2);
+    auto session = SessionDescriptor::create();
+    auto slow = ActivityDescriptor::create(URI, session);
+    auto fast = ActivityDescriptor::create(URI, session);
+
+    // The slow activity only finishes once the fast one has run, which needs a second worker
+    std::promise<void> done;
+    auto future = done.get_future().share();
+    std::atomic<bool> unblocked(false);
+
+    ASSERT_TRUE(executor->enqueueActivityTask(*slow, [future, &unblocked]() {
+        unblocked = future.wait_for(TIMEOUT) == std::future_status::ready;
+    }));
+    ASSERT_TRUE(executor->enqueueActivityTask(*fast, [&done]() { done.set_value(); }));
+
+    executor->shutdown();
+    ASSERT_TRUE(unblocked);
+}
+
+TEST(ThreadPoolExecutorTest, OrderedByKey)
+{
+    auto executor = ThreadPoolExecutor::create(3);
+    std::vector<int> order;
+
+    // Tasks with the same key never run at the same time, no lock needed
+    for (int i = 0; i < 100; i++)
+        ASSERT_TRUE(executor->enqueueOrderedTask(URI, [&order, i]() { order.emplace_back(i); }));
+
+    executor->shutdown();
+    ASSERT_EQ(100, order.size());
+    for (int i = 0; i < 100; i++)
+        ASSERT_EQ(i, order.at(i));
+}
+
+TEST(ThreadPoolExecutorTest, TasksEnqueuedFromTasks)
+{
+    auto executor = ThreadPoolExecutor::create(2);
+    std::atomic<int> count(0);
+    std::weak_ptr<ThreadPoolExecutor> weak = executor;
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(executor->enqueueTask([weak, &count]() {
+            count++;
+            if (auto pool = weak.lock())
+                pool->enqueueTask([&count]() { count++; });
+        }));
+    }
+
+    executor->shutdown();
+    ASSERT_EQ(20, count);
+}
+
+TEST(ThreadPoolExecutorTest, ShutdownDrainsAndRejects)
+{
+    auto executor = ThreadPoolExecutor::create(2);
+    std::atomic<int> count(0);
+
+    for (int i = 0; i < 100; i++)
+        ASSERT_TRUE(executor->enqueueTask([&count]() { count++; }));
+
+    executor->shutdown();
+    ASSERT_EQ(100, count);
+
+    ASSERT_FALSE(executor->enqueueTask([&count]() { count++; }));
+    ASSERT_FALSE(executor->enqueueOrderedTask(URI, [&count]() { count++; }));
+    ASSERT_FALSE(executor->enqueueTask(nullptr));
+
+    // A second shutdown does nothing
+    executor->shutdown();
+    ASSERT_EQ(100, count);
+}
+
+TEST(ThreadPoolExecutorTest, Metrics)
+{
+    auto executor = ThreadPoolExecutor::create(1);
+
+    std::promise<void> release;
+    auto future = release.get_future().share();
+    std::promise<void> started;
+
+    ASSERT_TRUE(executor->enqueueTask([future, &started]() {
+        started.set_value();
+        future.wait_for(TIMEOUT);
+    }));
+    ASSERT_EQ(std::future_status::ready, started.get_future().wait_for(TIMEOUT));
+
+    for (int i = 0; i < 10; i++)
+        ASSERT_TRUE(executor->enqueueTask([]() {}));
+
+    auto metrics = executor->getMetrics();
+    ASSERT_EQ(10, metrics.queueDepth);
+    ASSERT_EQ(10, metrics.maxQueueDepth);
+    ASSERT_EQ(0, metrics.executed);
+
+    release.set_value();
+    executor->shutdown();
+
+    metrics = executor->getMetrics();
+    ASSERT_EQ(0, metrics.queueDepth);
+    ASSERT_EQ(10, metrics.maxQueueDepth);
+    ASSERT_EQ(11, metrics.executed);
+    ASSERT_LE(metrics.averageLatency, metrics.maxLatency);
+}
+
+/**
+ * Commands are delivered through a local proxy from the worker threads.  Tasks hold the proxy
+ * weakly, so the ones still waiting when the proxy is released are dropped.
+ */
+TEST(ThreadPoolExecutorTest, LocalExtensionProxy)
+{
+    auto extension = std::make_shared<RecordingExtension>();
+    auto proxy = std::make_shared<LocalExtensionProxy>(extension);
+    auto executor = ThreadPoolExecutor::create(4);
+    std::weak_ptr<ExtensionProxy> weakProxy = proxy;
+
+    auto session = SessionDescriptor::create();
+    std::vector<ActivityDescriptorPtr> activities;
+    for (int i = 0; i < 3; i++)
+        activities.emplace_back(ActivityDescriptor::create(URI, session));
+
+    std::atomic<int> succeeded(0);
+    for (int id = 0; id < 50; id++) {
+        for (const auto& activity : activities) {
+            ASSERT_TRUE(executor->enqueueActivityTask(*activity, [weakProxy, activity, id, &succeeded]() {
+                auto proxy = weakProxy.lock();
+                if (!proxy)
+                    return;
+                rapidjson::Document command = Command("1.0").uri(URI).id(id).name("Record");
+                proxy->invokeCommand(*activity, command,
+                                     [&succeeded](const ActivityDescriptor&, const rapidjson::Value&) { succeeded++; },
+                                     [](const ActivityDescriptor&, const rapidjson::Value&) {});
+            }));
+        }
+    }
+
+    executor->shutdown();
+    ASSERT_EQ(150, succeeded);
+    ASSERT_EQ(3, extension->received.size());
+    for (const auto& entry : extension->received) {
+        ASSERT_EQ(50, entry.second.size());
+        for (int id = 0; id < 50; id++)
+            ASSERT_EQ(id, entry.second.at(id));
+    }
+
+    // Release the proxy while tasks are waiting
+    executor = ThreadPoolExecutor::create(1);
+    std::promise<void> release;
+    auto future = release.get_future().share();
+    executor->enqueueTask([future]() { future.wait_for(TIMEOUT); });
+    executor->enqueueActivityTask(*activities.at(0), [weakProxy, &succeeded]() {
+        if (weakProxy.lock())
+            succeeded++;
+    });
+    proxy.reset();
+    release.set_value();
+    executor->shutdown();
+    ASSERT_EQ(150, succeeded);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/*
+ * Measure the cost of one animation frame in the CoreTimeManager.
+ *
+ * A set of long-running animators is registered along with some regular timeouts, then the time
+ * manager is advanced one frame at a time.  Every allocation made while ticking is counted; the
+ * animator captures are large enough that copying one would allocate.
+ *
+ *     benchAnimators -n 40 -f 10000
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "utils.h"
+
+#include "apl/time/coretimemanager.h"
+
+static const char *USAGE_STRING = "benchAnimators [OPTIONS]";
+
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<size_t> sAllocations(0);
+
+void *
+operator new(std::size_t size)
+{
+    sAllocations++;
+    if (auto ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+int
+main(int argc, char *argv[])
+{
+    ArgumentSet argumentSet(USAGE_STRING);
+    int count = 40;
+    int frames = 10000;
+
+    argumentSet.add({
+        Argument("-n", "--count", Argument::ONE, "Number of running animators (default 40)", "COUNT",
+                 [&](const std::vector<std::string>& value) { count = std::stoi(value[0]); }),
+        Argument("-f", "--frames", Argument::ONE, "Number of frames to run (default 10000)", "FRAMES",
+                 [&](const std::vector<std::string>& value) { frames = std::stoi(value[0]); }),
+    });
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    argumentSet.parse(args);
+
+    apl::CoreTimeManager timeManager(0);
+    std::vector<double> values(count, 0);
+    auto duration = static_cast<apl::apl_duration_t>(frames) * 16 + 1000;
+
+    for (int i = 0 ; i < count ; i++) {
+        double start = i, end = i * 2 + 100, scale = 1.0 / duration;
+        auto *target = &values[i];
+        timeManager.setAnimator([start, end, scale, target](apl::apl_duration_t elapsed) {
+            *target = start + (end - start) * elapsed * scale;
+        }, duration);
+        timeManager.setTimeout([]() {}, duration * 2);
+    }
+
+    // The first frame may size internal buffers
+    apl::apl_time_t now = 16;
+    timeManager.updateTime(now);
+
+    auto allocations = sAllocations.load();
+    auto start = Clock::now();
+    for (int frame = 0 ; frame < frames ; frame++) {
+        now += 16;
+        timeManager.updateTime(now);
+    }
+    auto elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    allocations = sAllocations.load() - allocations;
+
+    std::cout << "animators=" << count << " frames=" << frames << std::endl;
+    std::cout << "tick=" << elapsed / frames << "us  allocations/tick="
+              << static_cast<double>(allocations) / frames << std::endl;
+
+    timeManager.terminate();
+    return allocations == 0 ? 0 : 1;
+}
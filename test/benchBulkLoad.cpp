@@ -0,0 +1,147 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/*
+ * Compare loading a LiveArray from a JSON response against loading it from a ColumnarBatch.
+ *
+ * The JSON path parses the response with rapidjson and converts each item into an ObjectMap,
+ * which is what a view host does today.  The binary path validates the batch and wraps each row
+ * in a map view.  Both paths then read every field once, as bindings would.
+ *
+ *     benchBulkLoad -n 5000 -r 20
+ */
+
+#include "utils.h"
+
+#include "apl/livedata/columnarbatch.h"
+
+static const char *USAGE_STRING = "benchBulkLoad [OPTIONS]";
+
+using Clock = std::chrono::steady_clock;
+
+static const std::vector<std::string> FIELDS = {"id", "title", "subtitle", "price", "featured"};
+
+static std::string
+makeJson(int count)
+{
+    std::string result = "[";
+    for (int i = 0 ; i < count ; i++) {
+        if (i > 0)
+            result += ",";
+        result += R"({"id":)" + std::to_string(i) +
+                  R"(,"title":"Item number )" + std::to_string(i) +
+                  R"(","subtitle":"A longer description of item )" + std::to_string(i) +
+                  R"(","price":)" + std::to_string(i * 0.25) +
+                  R"(,"featured":)" + (i % 3 == 0 ? "true" : "false") + "}";
+    }
+    return result + "]";
+}
+
+static std::vector<std::uint8_t>
+makeBatch(int count)
+{
+    apl::ColumnarBatchBuilder builder({{"id", apl::ColumnarBatch::kNumber},
+                                       {"title", apl::ColumnarBatch::kString},
+                                       {"subtitle", apl::ColumnarBatch::kString},
+                                       {"price", apl::ColumnarBatch::kNumber},
+                                       {"featured", apl::ColumnarBatch::kBoolean}});
+    for (int i = 0 ; i < count ; i++)
+        builder.add({i,
+                     "Item number " + std::to_string(i),
+                     "A longer description of item " + std::to_string(i),
+                     i * 0.25,
+                     i % 3 == 0});
+    return builder.build();
+}
+
+static size_t
+touchFields(const apl::LiveArrayPtr& array)
+{
+    size_t total = 0;
+    array->forEach([&](const apl::Object& item) {
+        for (const auto& field : FIELDS)
+            total += item.get(field).isNull() ? 0 : 1;
+    });
+    return total;
+}
+
+int
+main(int argc, char *argv[])
+{
+    ArgumentSet argumentSet(USAGE_STRING);
+    int count = 5000;
+    int repeat = 20;
+
+    argumentSet.add({
+        Argument("-n", "--count", Argument::ONE, "Number of items per response (default 5000)", "COUNT",
+                 [&](const std::vector<std::string>& value) { count = std::stoi(value[0]); }),
+        Argument("-r", "--repeat", Argument::ONE, "Number of responses to load (default 20)", "REPEAT",
+                 [&](const std::vector<std::string>& value) { repeat = std::stoi(value[0]); }),
+    });
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    argumentSet.parse(args);
+
+    auto json = makeJson(count);
+    auto binary = makeBatch(count);
+    std::cout << "items=" << count << " json=" << json.size() << " bytes binary=" << binary.size()
+              << " bytes" << std::endl;
+
+    double jsonLoad = 0, jsonRead = 0, binaryLoad = 0, binaryRead = 0;
+    size_t checksum = 0;
+
+    for (int r = 0 ; r < repeat ; r++) {
+        auto start = Clock::now();
+        rapidjson::Document doc;
+        doc.Parse(json.c_str());
+        apl::ObjectArray items;
+        items.reserve(doc.Size());
+        for (const auto& value : doc.GetArray()) {
+            auto map = std::make_shared<apl::ObjectMap>();
+            for (const auto& member : value.GetObject())
+                map->emplace(member.name.GetString(), apl::Object(member.value));
+            items.emplace_back(map);
+        }
+        auto array = apl::LiveArray::create(std::move(items));
+        jsonLoad += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        checksum += touchFields(array);
+        jsonRead += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        auto batch = apl::ColumnarBatch::create(std::vector<std::uint8_t>(binary));
+        if (!batch) {
+            std::cerr << "Invalid batch" << std::endl;
+            return 1;
+        }
+        auto bulk = apl::LiveArray::create();
+        bulk->push_back(batch->rows().begin(), batch->rows().end());
+        binaryLoad += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        checksum -= touchFields(bulk);
+        binaryRead += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    std::cout << "json   load=" << jsonLoad / repeat << "ms  read=" << jsonRead / repeat << "ms" << std::endl;
+    std::cout << "binary load=" << binaryLoad / repeat << "ms  read=" << binaryRead / repeat << "ms" << std::endl;
+
+    if (checksum != 0) {
+        std::cerr << "Field counts disagree" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/*
+ * Compare prepend, middle insert and middle remove on a LiveArray (block storage) against a
+ * plain ObjectArray at a range of sizes.
+ *
+ *     benchChunkedArray -o 2000 -s 1000,10000,100000
+ */
+
+#include "utils.h"
+
+static const char *USAGE_STRING = "benchChunkedArray [OPTIONS]";
+
+using Clock = std::chrono::steady_clock;
+
+static double
+nanosPerOp(Clock::time_point start, int ops)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ops;
+}
+
+static apl::ObjectArray
+makeItems(size_t size)
+{
+    apl::ObjectArray items;
+    items.reserve(size);
+    for (size_t i = 0 ; i < size ; i++)
+        items.emplace_back("item " + std::to_string(i));
+    return items;
+}
+
+static void
+runVector(size_t size, int ops)
+{
+    auto items = makeItems(size);
+
+    auto start = Clock::now();
+    for (int i = 0 ; i < ops ; i++)
+        items.insert(items.begin(), apl::Object("prepend"));
+    auto prepend = nanosPerOp(start, ops);
+
+    start = Clock::now();
+    for (int i = 0 ; i < ops ; i++)
+        items.insert(items.begin() + items.size() / 2, apl::Object("middle"));
+    auto insert = nanosPerOp(start, ops);
+
+    start = Clock::now();
+    for (int i = 0 ; i < ops ; i++)
+        items.erase(items.begin() + items.size() / 2);
+    auto remove = nanosPerOp(start, ops);
+
+    std::cout << "vector     size=" << size << "  prepend=" << prepend << "ns  insert=" << insert
+              << "ns  remove=" << remove << "ns" << std::endl;
+}
+
+static void
+runLiveArray(size_t size, int ops)
+{
+    auto array = apl::LiveArray::create(makeItems(size));
+
+    auto start = Clock::now();
+    for (int i = 0 ; i < ops ; i++)
+        array->insert(0, apl::Object("prepend"));
+    auto prepend = nanosPerOp(start, ops);
+
+    start = Clock::now();
+    for (int i = 0 ; i < ops ; i++)
+        array->insert(array->size() / 2, apl::Object("middle"));
+    auto insert = nanosPerOp(start, ops);
+
+    start = Clock::now();
+    for (int i = 0 ; i < ops ; i++)
+        array->remove(array->size() / 2);
+    auto remove = nanosPerOp(start, ops);
+
+    // Random access and the materialized view after the edits
+    start = Clock::now();
+    size_t total = 0;
+    for (size_t i = 0 ; i < array->size() ; i++)
+        total += array->at(i).isString() ? 1 : 0;
+    auto access = nanosPerOp(start, static_cast<int>(array->size()));
+
+    start = Clock::now();
+    total += array->getArray().size();
+    auto view = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::cout << "livearray  size=" << size << "  prepend=" << prepend << "ns  insert=" << insert
+              << "ns  remove=" << remove << "ns  at=" << access << "ns  getArray=" << view << "ms"
+              << (total == 0 ? " (empty)" : "") << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+    ArgumentSet argumentSet(USAGE_STRING);
+    int ops = 2000;
+    std::vector<size_t> sizes = {1000, 10000, 100000};
+
+    argumentSet.add({
+        Argument("-o", "--ops", Argument::ONE, "Number of operations of each kind (default 2000)", "OPS",
+                 [&](const std::vector<std::string>& value) { ops = std::stoi(value[0]); }),
+        Argument("-s", "--sizes", Argument::ONE, "Comma-separated array sizes (default 1000,10000,100000)", "SIZES",
+                 [&](const std::vector<std::string>& value) {
+                     sizes.clear();
+                     std::stringstream ss(value[0]);
+                     std::string item;
+                     while (std::getline(ss, item, ','))
+                         sizes.push_back(std::stoul(item));
+                 }),
+    });
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    argumentSet.parse(args);
+
+    for (auto size : sizes) {
+        runVector(size, ops);
+        runLiveArray(size, ops);
+    }
+
+    return 0;
+}
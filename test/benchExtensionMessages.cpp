@@ -0,0 +1,255 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/*
+ * Measure the throughput of extension messages delivered to a document.
+ *
+ * A local extension publishes LiveDataUpdate messages that replace the contents of a live array
+ * bound in the document, then Event messages that run a handler in the document.  The messages go
+ * through the ExtensionMediator either with the synchronous executor, where they are processed on
+ * the caller's thread, or with a queue that is drained after every message, as a view host with
+ * its own message loop does.
+ *
+ *     benchExtensionMessages -n 2000 -i 50
+ */
+
+#include <deque>
+
+#include "utils.h"
+
+#include "alexaext/alexaext.h"
+#include "apl/extension/extensionmediator.h"
+
+static const char *USAGE_STRING = "benchExtensionMessages [OPTIONS]";
+
+using Clock = std::chrono::steady_clock;
+
+static const char *URI = "aplext:bench:10";
+
+static const char *SCHEMA = R"({
+  "type": "Schema",
+  "version": "1.0",
+  "types": [
+    {
+      "name": "Item",
+      "properties": {
+        "id": "number",
+        "title": "string"
+      }
+    }
+  ],
+  "events": [
+    { "name": "onTick", "mode": "FAST" }
+  ],
+  "liveData": [
+    {
+      "name": "items",
+      "type": "Item[]"
+    }
+  ]
+})";
+
+static const char *DOCUMENT = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "extensions": [
+    {
+      "uri": "aplext:bench:10",
+      "name": "Bench"
+    }
+  ],
+  "mainTemplate": {
+    "item": {
+      "type": "Container",
+      "items": [
+        {
+          "type": "Text",
+          "id": "count",
+          "text": "${items.length}"
+        },
+        {
+          "type": "Text",
+          "id": "tick"
+        }
+      ]
+    }
+  },
+  "Bench:onTick": [
+    {
+      "type": "SetValue",
+      "componentId": "tick",
+      "property": "text",
+      "value": "${event.tick}"
+    }
+  ]
+})";
+
+class BenchExtension : public alexaext::ExtensionBase {
+public:
+    BenchExtension() : ExtensionBase(URI) {}
+
+    rapidjson::Document createRegistration(const std::string& uri, const rapidjson::Value& registerRequest) override {
+        rapidjson::Document schema;
+        schema.Parse(SCHEMA);
+        schema.AddMember("uri", rapidjson::Value(uri.c_str(), schema.GetAllocator()), schema.GetAllocator());
+        return alexaext::RegistrationSuccess("1.0").uri(uri).token("BenchToken").schema(schema);
+    }
+
+    bool publish(const rapidjson::Value& update) {
+        return invokeLiveDataUpdate(URI, update);
+    }
+
+    bool tick(int count) {
+        auto event = alexaext::Event("1.0").uri(URI).target(URI).name("onTick").property("tick", count);
+        return invokeExtensionEventHandler(URI, event);
+    }
+};
+
+/**
+ * Executor that holds the tasks until the view host drains it.
+ */
+class QueueExecutor : public alexaext::Executor {
+public:
+    bool enqueueTask(Task task) override {
+        mTasks.emplace_back(std::move(task));
+        return true;
+    }
+
+    void drain() {
+        while (!mTasks.empty()) {
+            auto task = std::move(mTasks.front());
+            mTasks.pop_front();
+            task();
+        }
+    }
+
+private:
+    std::deque<Task> mTasks;
+};
+
+static rapidjson::Document
+makeUpdate(int items)
+{
+    rapidjson::Document doc;
+    auto& alloc = doc.GetAllocator();
+    rapidjson::Value array(rapidjson::kArrayType);
+    for (int i = 0 ; i < items ; i++) {
+        rapidjson::Value item(rapidjson::kObjectType);
+        item.AddMember("id", i, alloc);
+        item.AddMember("title", rapidjson::Value(("Item number " + std::to_string(i)).c_str(), alloc), alloc);
+        array.PushBack(item, alloc);
+    }
+
+    rapidjson::Value clear(rapidjson::kObjectType);
+    clear.AddMember("type", "Clear", alloc);
+    rapidjson::Value insert(rapidjson::kObjectType);
+    insert.AddMember("type", "Insert", alloc);
+    insert.AddMember("index", 0, alloc);
+    insert.AddMember("item", array, alloc);
+    rapidjson::Value operations(rapidjson::kArrayType);
+    operations.PushBack(clear, alloc);
+    operations.PushBack(insert, alloc);
+
+    doc.SetObject();
+    doc.AddMember("version", "1.0", alloc);
+    doc.AddMember("method", "LiveDataUpdate", alloc);
+    doc.AddMember("name", "items", alloc);
+    doc.AddMember("target", rapidjson::Value(URI, alloc), alloc);
+    doc.AddMember("operations", operations, alloc);
+    return doc;
+}
+
+/**
+ * Publish the update, then the events, the requested number of times.
+ * @return Microseconds per update and per event, negative if the document did not receive them.
+ */
+static std::pair<double, double>
+run(const alexaext::ExecutorPtr& executor, QueueExecutor *queue, const rapidjson::Value& update,
+    int messages, int items)
+{
+    auto provider = std::make_shared<alexaext::ExtensionRegistrar>();
+    auto extension = std::make_shared<BenchExtension>();
+    provider->registerExtension(std::make_shared<alexaext::LocalExtensionProxy>(extension));
+    auto mediator = apl::ExtensionMediator::create(provider, executor);
+
+    auto content = apl::Content::create(DOCUMENT, apl::makeDefaultSession());
+    auto config = apl::RootConfig::create();
+    config->enableExperimentalFeature(apl::RootConfig::kExperimentalFeatureExtensionProvider)
+        .extensionProvider(provider)
+        .extensionMediator(mediator);
+    mediator->loadExtensions(apl::ObjectMap{}, content);
+    if (queue)
+        queue->drain();
+
+    auto root = apl::RootContext::create(apl::Metrics().size(1024, 800), content, *config);
+    if (!root)
+        return {-1, -1};
+
+    auto start = Clock::now();
+    for (int i = 0 ; i < messages ; i++) {
+        extension->publish(update);
+        if (queue)
+            queue->drain();
+        root->clearPending();
+    }
+    auto updates = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / messages;
+
+    start = Clock::now();
+    for (int i = 1 ; i <= messages ; i++) {
+        extension->tick(i);
+        if (queue)
+            queue->drain();
+        root->clearPending();
+    }
+    auto events = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / messages;
+
+    auto count = root->findComponentById("count")->getCalculated(apl::kPropertyText).asString();
+    auto tick = root->findComponentById("tick")->getCalculated(apl::kPropertyText).asString();
+    return {count == std::to_string(items) ? updates : -1, tick == std::to_string(messages) ? events : -1};
+}
+
+int
+main(int argc, char *argv[])
+{
+    ArgumentSet argumentSet(USAGE_STRING);
+    int messages = 2000;
+    int items = 50;
+
+    argumentSet.add({
+        Argument("-n", "--messages", Argument::ONE, "Number of messages to publish (default 2000)", "MESSAGES",
+                 [&](const std::vector<std::string>& value) { messages = std::stoi(value[0]); }),
+        Argument("-i", "--items", Argument::ONE, "Number of live array items per message (default 50)", "ITEMS",
+                 [&](const std::vector<std::string>& value) { items = std::stoi(value[0]); }),
+    });
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    argumentSet.parse(args);
+
+    auto update = makeUpdate(items);
+    auto queue = std::make_shared<QueueExecutor>();
+
+    auto synchronous = run(alexaext::Executor::getSynchronousExecutor(), nullptr, update, messages, items);
+    auto queued = run(queue, queue.get(), update, messages, items);
+    if (synchronous.first < 0 || synchronous.second < 0 || queued.first < 0 || queued.second < 0) {
+        std::cerr << "The document did not receive the messages" << std::endl;
+        return 1;
+    }
+
+    std::cout << "messages=" << messages << " items=" << items << std::endl;
+    std::cout << "synchronous updates=" << synchronous.first << "us/message (" << 1e6 / synchronous.first << "/s)"
+              << " events=" << synchronous.second << "us/message (" << 1e6 / synchronous.second << "/s)" << std::endl;
+    std::cout << "queued updates=" << queued.first << "us/message (" << 1e6 / queued.first << "/s)"
+              << " events=" << queued.second << "us/message (" << 1e6 / queued.second << "/s)" << std::endl;
+    return 0;
+}
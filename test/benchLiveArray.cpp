@@ -0,0 +1,212 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/*
+ * Measure the cost of applying a burst of LiveArray changes to a bound Sequence.
+ *
+ * The "map" figures compare mapping every new index back to its old index by walking the
+ * change log once per index (the previous algorithm) against walking a compiled
+ * LiveArrayIndexMap.  The "rebuild" figure is the end-to-end cost of flushing the changes
+ * into the layout.
+ *
+ *     benchLiveArray -n 2000 -k 50 -r 100
+ */
+
+#include "utils.h"
+
+#include <random>
+
+#include "apl/livedata/livearrayindexmap.h"
+
+static const char *USAGE_STRING = "benchLiveArray [OPTIONS]";
+
+static const char *DOCUMENT = R"({
+  "type": "APL",
+  "version": "2023.2",
+  "mainTemplate": {
+    "items": {
+      "type": "Sequence",
+      "height": 800,
+      "data": "${TestArray}",
+      "items": {
+        "type": "Text",
+        "height": 40,
+        "text": "${index}: ${data}"
+      }
+    }
+  }
+})";
+
+/**
+ * The original O(n * k) mapping: walk the change log backwards for each index.
+ */
+static std::pair<int, bool>
+legacyNewToOld(const std::vector<apl::LiveArrayChange>& changes, size_t index)
+{
+    bool changed = false;
+    for (auto it = changes.rbegin() ; it != changes.rend() ; it++) {
+        auto position = it->position();
+        auto count = it->count();
+        switch (it->command()) {
+            case apl::LiveArrayChange::REMOVE:
+                if (index >= position)
+                    index += count;
+                break;
+            case apl::LiveArrayChange::UPDATE:
+                if (index >= position && index < position + count)
+                    changed = true;
+                break;
+            case apl::LiveArrayChange::INSERT:
+                if (index >= position + count)
+                    index -= count;
+                else if (index >= position)
+                    return {-1, false};
+                break;
+            default:
+                break;
+        }
+    }
+    return {static_cast<int>(index), changed};
+}
+
+/**
+ * Apply a random mix of single-item inserts, updates and removes.  The changes are applied to
+ * the live array (if there is one) and recorded in the change log.
+ */
+static void
+applyChanges(std::mt19937& random, size_t& size, int changeCount, int counter,
+             const apl::LiveArrayPtr& liveArray, std::vector<apl::LiveArrayChange>& changes)
+{
+    for (int i = 0 ; i < changeCount ; i++) {
+        auto op = random() % 3;
+        if (size == 0)
+            op = 0;
+
+        if (op == 0) {
+            auto position = random() % (size + 1);
+            if (liveArray)
+                liveArray->insert(position, "new " + std::to_string(counter));
+            changes.emplace_back(apl::LiveArrayChange::insert(position, 1));
+            size++;
+        }
+        else if (op == 1) {
+            auto position = random() % size;
+            if (liveArray)
+                liveArray->update(position, "updated " + std::to_string(counter));
+            changes.emplace_back(apl::LiveArrayChange::update(position, 1));
+        }
+        else {
+            auto position = random() % size;
+            if (liveArray)
+                liveArray->remove(position);
+            changes.emplace_back(apl::LiveArrayChange::remove(position, 1));
+            size--;
+        }
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    ArgumentSet argumentSet(USAGE_STRING);
+    int count = 2000;
+    int changeCount = 50;
+    int repeat = 100;
+
+    argumentSet.add({
+        Argument("-n", "--count", Argument::ONE, "Number of items in the array (default 2000)", "COUNT",
+                 [&](const std::vector<std::string>& value) { count = std::stoi(value[0]); }),
+        Argument("-k", "--changes", Argument::ONE, "Number of changes per flush (default 50)", "CHANGES",
+                 [&](const std::vector<std::string>& value) { changeCount = std::stoi(value[0]); }),
+        Argument("-r", "--repeat", Argument::ONE, "Number of flushes to time (default 100)", "REPEAT",
+                 [&](const std::vector<std::string>& value) { repeat = std::stoi(value[0]); }),
+    });
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    argumentSet.parse(args);
+
+    std::cout << "items=" << count << " changes/flush=" << changeCount << " flushes=" << repeat << std::endl;
+
+    // Index mapping alone
+    {
+        std::mt19937 random(1);
+        double legacyMs = 0;
+        double compiledMs = 0;
+        long checksum = 0;
+
+        for (int r = 0 ; r < repeat ; r++) {
+            size_t size = count;
+            std::vector<apl::LiveArrayChange> changes;
+            applyChanges(random, size, changeCount, r, nullptr, changes);
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0 ; i < size ; i++)
+                checksum += legacyNewToOld(changes, i).first;
+            legacyMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            apl::LiveArrayIndexMap map(changes, size);
+            for (const auto& run : map.runs()) {
+                for (size_t i = 0 ; i < run.count ; i++)
+                    checksum -= run.oldIndex < 0 ? -1 : run.oldIndex + static_cast<int>(i);
+            }
+            compiledMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        std::cout << "map legacy:   " << legacyMs / repeat << " ms/flush" << std::endl;
+        std::cout << "map compiled: " << compiledMs / repeat << " ms/flush" << std::endl;
+        if (checksum != 0) {
+            std::cerr << "Index maps disagree" << std::endl;
+            return 1;
+        }
+    }
+
+    // End-to-end layout rebuild
+    {
+        apl::ObjectArray items;
+        for (int i = 0 ; i < count ; i++)
+            items.emplace_back("item " + std::to_string(i));
+        auto liveArray = apl::LiveArray::create(std::move(items));
+
+        auto config = apl::RootConfig().liveData("TestArray", liveArray);
+        auto content = apl::Content::create(DOCUMENT, apl::makeDefaultSession());
+        if (!content || !content->isReady()) {
+            std::cerr << "Unable to create content" << std::endl;
+            return 1;
+        }
+
+        auto root = apl::RootContext::create(apl::Metrics().size(1280, 800).dpi(160), content, config);
+        if (!root) {
+            std::cerr << "Unable to inflate document" << std::endl;
+            return 1;
+        }
+
+        std::mt19937 random(2);
+        size_t size = count;
+        double elapsedMs = 0;
+        for (int r = 0 ; r < repeat ; r++) {
+            std::vector<apl::LiveArrayChange> changes;
+            applyChanges(random, size, changeCount, r, liveArray, changes);
+
+            auto start = std::chrono::steady_clock::now();
+            root->clearPending();
+            elapsedMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            root->clearDirty();
+        }
+
+        std::cout << "rebuild:      " << elapsedMs / repeat << " ms/flush" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/*
+ * Compare DOM serialization through a rapidjson::Value against streaming into a JsonSink.
+ *
+ * Each mode is best measured in its own process, because peak resident memory never decreases:
+ *
+ *     benchSerialize -m value -n 5000
+ *     benchSerialize -m stream -n 5000
+ */
+
+#include "utils.h"
+
+#include <sys/resource.h>
+
+#include "rapidjson/writer.h"
+
+#include "apl/utils/jsonsink.h"
+
+static const char *USAGE_STRING = "benchSerialize [OPTIONS]";
+
+/**
+ * RapidJSON output stream that counts and discards characters
+ */
+class CountingStream {
+public:
+    using Ch = char;
+    void Put(Ch) { mCount++; }
+    void Flush() {}
+    size_t count() const { return mCount; }
+
+private:
+    size_t mCount = 0;
+};
+
+static long
+peakResidentKb()
+{
+    struct rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static std::string
+makeDocument(int count)
+{
+    return R"({
+      "type": "APL",
+      "version": "2023.2",
+      "mainTemplate": {
+        "items": {
+          "type": "Container",
+          "data": "${Array.range()" + std::to_string(count) + R"()}",
+          "items": {
+            "type": "Frame",
+            "borderWidth": 1,
+            "item": {
+              "type": "Text",
+              "text": "Item ${data} of ${length}",
+              "accessibilityLabel": "Label ${data}"
+            }
+          }
+        }
+      }
+    })";
+}
+
+int
+main(int argc, char *argv[])
+{
+    ArgumentSet argumentSet(USAGE_STRING);
+    int count = 1000;
+    int repeat = 10;
+    bool extended = false;
+    std::string mode = "both";
+
+    argumentSet.add({
+        Argument("-n", "--count", Argument::ONE, "Number of components to inflate (default 1000)", "COUNT",
+                 [&](const std::vector<std::string>& value) { count = std::stoi(value[0]); }),
+        Argument("-r", "--repeat", Argument::ONE, "Number of serializations to time (default 10)", "REPEAT",
+                 [&](const std::vector<std::string>& value) { repeat = std::stoi(value[0]); }),
+        Argument("-x", "--extended", Argument::NONE, "Serialize the extended DOM", "",
+                 [&](const std::vector<std::string>&) { extended = true; }),
+        Argument("-m", "--mode", Argument::ONE, "One of 'value', 'stream' or 'both' (default)", "MODE",
+                 [&](const std::vector<std::string>& value) { mode = value[0]; }),
+    });
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    argumentSet.parse(args);
+
+    auto content = apl::Content::create(makeDocument(count), apl::makeDefaultSession());
+    if (!content || !content->isReady()) {
+        std::cerr << "Unable to create content" << std::endl;
+        return 1;
+    }
+
+    auto root = apl::RootContext::create(apl::Metrics().size(1280, 800).dpi(160), content);
+    if (!root) {
+        std::cerr << "Unable to inflate document" << std::endl;
+        return 1;
+    }
+
+    auto baseline = peakResidentKb();
+    std::cout << "components=" << count << " extended=" << extended << " baseline_rss_kb=" << baseline << std::endl;
+
+    if (mode == "value" || mode == "both") {
+        size_t bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeat; i++) {
+            rapidjson::Document doc;
+            auto dom = root->serializeDOM(extended, doc.GetAllocator());
+            CountingStream out;
+            rapidjson::Writer<CountingStream> writer(out);
+            dom.Accept(writer);
+            bytes = out.count();
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        std::cout << "value:  " << elapsed.count() / repeat << " ms/iteration, " << bytes << " bytes, "
+                  << "peak_rss_delta_kb=" << peakResidentKb() - baseline << std::endl;
+    }
+
+    if (mode == "stream" || mode == "both") {
+        size_t bytes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeat; i++) {
+            CountingStream out;
+            rapidjson::Writer<CountingStream> writer(out);
+            apl::JsonWriterSink<rapidjson::Writer<CountingStream>> sink(writer);
+            root->serializeDOM(extended, sink);
+            bytes = out.count();
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        std::cout << "stream: " << elapsed.count() / repeat << " ms/iteration, " << bytes << " bytes, "
+                  << "peak_rss_delta_kb=" << peakResidentKb() - baseline << std::endl;
+    }
+
+    return 0;
+}
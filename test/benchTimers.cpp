@@ -0,0 +1,108 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/*
+ * Compare the timer heap against the timer wheel under set/cancel churn.
+ *
+ * Each frame sets a batch of short timeouts, cancels most of the outstanding ones in random
+ * order, and advances the clock by one frame so that the rest fire.  This is the pattern of
+ * documents that start and cancel many delays, auto-page timers, or gesture timeouts.
+ *
+ *     benchTimers -n 200 -f 2000
+ */
+
+#include "utils.h"
+
+#include "apl/time/coretimemanager.h"
+#include "apl/time/timerwheel.h"
+#include "apl/utils/make_unique.h"
+
+static const char *USAGE_STRING = "benchTimers [OPTIONS]";
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    double milliseconds;
+    size_t fired;
+};
+
+static Result
+run(std::unique_ptr<apl::TimerQueue> timers, int perFrame, int frames, int pending)
+{
+    apl::CoreTimeManager timeManager(0, std::move(timers));
+    std::vector<apl::timeout_id> outstanding;
+    std::uint32_t seed = 1;
+    auto random = [&](std::uint32_t range) {
+        seed = seed * 1664525 + 1013904223;
+        return (seed >> 8) % range;
+    };
+
+    size_t fired = 0;
+    apl::apl_time_t now = 0;
+    auto start = Clock::now();
+    for (int frame = 0 ; frame < frames ; frame++) {
+        for (int i = 0 ; i < perFrame ; i++)
+            outstanding.emplace_back(timeManager.setTimeout([&fired]() { fired++; }, 10 + random(5000)));
+
+        // Cancel timers until only the pending count is left; some of them have already fired
+        while (static_cast<int>(outstanding.size()) > pending) {
+            auto index = random(outstanding.size());
+            timeManager.clearTimeout(outstanding[index]);
+            outstanding[index] = outstanding.back();
+            outstanding.pop_back();
+        }
+
+        now += 16;
+        timeManager.updateTime(now);
+    }
+    auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    timeManager.terminate();
+    return {elapsed, fired};
+}
+
+int
+main(int argc, char *argv[])
+{
+    ArgumentSet argumentSet(USAGE_STRING);
+    int perFrame = 200;
+    int frames = 2000;
+    int pending = 2000;
+
+    argumentSet.add({
+        Argument("-n", "--count", Argument::ONE, "Timeouts set per frame (default 200)", "COUNT",
+                 [&](const std::vector<std::string>& value) { perFrame = std::stoi(value[0]); }),
+        Argument("-f", "--frames", Argument::ONE, "Number of frames (default 2000)", "FRAMES",
+                 [&](const std::vector<std::string>& value) { frames = std::stoi(value[0]); }),
+        Argument("-p", "--pending", Argument::ONE, "Outstanding timeouts kept between frames (default 2000)", "PENDING",
+                 [&](const std::vector<std::string>& value) { pending = std::stoi(value[0]); }),
+    });
+
+    std::vector<std::string> args(argv + 1, argv + argc);
+    argumentSet.parse(args);
+
+    auto heap = run(std::make_unique<apl::HeapTimerQueue>(), perFrame, frames, pending);
+    auto wheel = run(std::make_unique<apl::TimerWheel>(), perFrame, frames, pending);
+
+    std::cout << "timeouts/frame=" << perFrame << " frames=" << frames << " pending=" << pending << std::endl;
+    std::cout << "heap  " << heap.milliseconds << "ms  fired=" << heap.fired << std::endl;
+    std::cout << "wheel " << wheel.milliseconds << "ms  fired=" << wheel.fired << std::endl;
+
+    if (heap.fired != wheel.fired) {
+        std::cerr << "Timer queues disagree" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}